@@ -68,6 +68,7 @@ let objectServerTestSources = [
     "RLMWatchTestUtility.h",
     "RLMWatchTestUtility.m",
     "RealmServer.swift",
+    "StubHTTPServer.swift",
     "SwiftAsymmetricSyncServerTests.swift",
     "SwiftCollectionSyncTests.swift",
     "SwiftFlexibleSyncServerTests.swift",
@@ -362,6 +363,7 @@ let package = Package(
             dependencies: ["RealmSwift", "RealmTestSupport", "RealmSyncTestSupport", "RealmSwiftTestSupport"],
             sources: [
                  "RealmServer.swift",
+                 "StubHTTPServer.swift",
                  "SwiftServerObjects.swift",
                  "SwiftSyncTestCase.swift",
                  "TimeoutProxyServer.swift",
@@ -20,6 +20,9 @@
 #import "RLMUUID_Private.hpp"
 
 #import <realm/util/bson/bson.hpp>
+#import <realm/util/to_string.hpp>
+
+#import <sstream>
 
 #import <XCTest/XCTest.h>
 
@@ -156,4 +159,199 @@ using namespace realm::bson;
     XCTAssertEqualObjects(RLMConvertBsonToRLMBSON(bsonDocument["uuid"]), document[@"uuid"]);
 }
 
+#pragma mark - Lazy documents
+
+static BsonDocument makeTestDocument() {
+    return static_cast<BsonDocument>(RLMConvertRLMBSONToBson(@{
+        @"string": @"short",
+        @"longString": [@"" stringByPaddingToLength:100 withString:@"abc" startingAtIndex:0],
+        @"int": @5,
+        @"binary": [NSMutableData dataWithLength:100],
+        @"nestedarray": @[@[@1, @2], @[@3, @4]],
+        @"nesteddoc": @{@"a": @1, @"b": @{@"c": @"d"}},
+    }));
+}
+
+- (void)testLazyDocumentMatchesEagerConversion {
+    auto document = makeTestDocument();
+    id<RLMBSON> eager = RLMConvertBsonToRLMBSON(document);
+    NSDictionary *lazy = RLMMakeLazyBSONDocument(BsonDocument(document));
+    XCTAssertTrue([lazy isKindOfClass:[RLMBSONDocument class]]);
+    XCTAssertEqual(lazy.bsonType, RLMBSONTypeDocument);
+    XCTAssertEqualObjects(lazy, eager);
+    XCTAssertEqualObjects([NSSet setWithArray:lazy.allKeys], [NSSet setWithArray:((NSDictionary *)eager).allKeys]);
+    XCTAssertNil(lazy[@"missing"]);
+
+    XCTAssertTrue([lazy[@"nesteddoc"] isKindOfClass:[RLMBSONDocument class]]);
+    XCTAssertTrue([lazy[@"nestedarray"] isKindOfClass:[RLMBSONArray class]]);
+    XCTAssertTrue([lazy[@"nestedarray"][0] isKindOfClass:[RLMBSONArray class]]);
+    XCTAssertEqualObjects(lazy[@"nesteddoc"][@"b"][@"c"], @"d");
+
+    // Values are converted once and then reused
+    XCTAssertEqual(lazy[@"nesteddoc"], lazy[@"nesteddoc"]);
+    XCTAssertEqual(lazy.copy, lazy);
+
+    XCTAssertEqual(RLMConvertRLMBSONToBson(lazy), Bson(document));
+}
+
+- (void)testLazyDocumentValuesOutliveDocument {
+    NSString *longString;
+    NSData *binary;
+    NSArray *array;
+    @autoreleasepool {
+        NSDictionary *lazy = RLMMakeLazyBSONDocument(makeTestDocument());
+        longString = lazy[@"longString"];
+        binary = lazy[@"binary"];
+        array = lazy[@"nestedarray"];
+    }
+    XCTAssertEqualObjects(longString, [@"" stringByPaddingToLength:100 withString:@"abc" startingAtIndex:0]);
+    XCTAssertEqualObjects(binary, [NSMutableData dataWithLength:100]);
+    XCTAssertEqualObjects(array, (@[@[@1, @2], @[@3, @4]]));
+}
+
+- (void)testLazyDocumentWithManyFields {
+    BsonDocument document;
+    for (int i = 0; i < 100; ++i) {
+        document[realm::util::format("field%1", i)] = i;
+    }
+    NSDictionary *lazy = RLMMakeLazyBSONDocument(std::move(document));
+    XCTAssertEqual(lazy.count, 100U);
+    for (int i = 0; i < 100; ++i) {
+        XCTAssertEqualObjects(lazy[[NSString stringWithFormat:@"field%d", i]], @(i));
+    }
+    __block int fields = 0;
+    [lazy enumerateKeysAndObjectsUsingBlock:^(NSString *key, NSNumber *value, BOOL *) {
+        XCTAssertEqualObjects(key, ([NSString stringWithFormat:@"field%d", value.intValue]));
+        ++fields;
+    }];
+    XCTAssertEqual(fields, 100);
+}
+
+- (void)testLazyArray {
+    BsonArray array;
+    for (int i = 0; i < 10; ++i) {
+        array.push_back(BsonDocument{{"value", i}});
+    }
+    NSArray *lazy = RLMMakeLazyBSONArray(std::move(array));
+    XCTAssertEqual(lazy.count, 10U);
+    XCTAssertEqual(lazy.bsonType, RLMBSONTypeArray);
+    int expected = 0;
+    for (NSDictionary *document in lazy) {
+        XCTAssertEqualObjects(document[@"value"], @(expected++));
+    }
+    XCTAssertEqual(expected, 10);
+    XCTAssertThrowsSpecificNamed(lazy[10], NSException, NSRangeException);
+}
+
+static BsonArray makeFindResults() {
+    BsonArray results;
+    for (int i = 0; i < 2000; ++i) {
+        BsonArray tags;
+        for (int j = 0; j < 10; ++j) {
+            tags.push_back(realm::util::format("tag %1", j));
+        }
+        results.push_back(BsonDocument{
+            {"_id", realm::ObjectId::gen()},
+            {"name", realm::util::format("name %1", i)},
+            {"age", i},
+            {"address", BsonDocument{{"street", "1 Main Street"}, {"city", "Springfield"}}},
+            {"tags", tags},
+        });
+    }
+    return results;
+}
+
+- (void)testEagerConversionPerformance {
+    auto results = makeFindResults();
+    [self measureBlock:^{
+        @autoreleasepool {
+            NSArray *documents = (NSArray *)RLMConvertBsonToRLMBSON(results);
+            for (NSDictionary *document in documents) {
+                (void)document[@"name"];
+                (void)document[@"age"];
+            }
+        }
+    }];
+}
+
+- (void)testLazyConversionPerformance {
+    auto results = makeFindResults();
+    [self measureBlock:^{
+        @autoreleasepool {
+            // Unlike the eager conversion this has to copy the results, so
+            // it slightly understates the difference
+            NSArray *documents = RLMMakeLazyBSONArray(BsonArray(results));
+            for (NSDictionary *document in documents) {
+                (void)document[@"name"];
+                (void)document[@"age"];
+            }
+        }
+    }];
+}
+
+#pragma mark - Extended JSON
+
+static NSDictionary<NSString *, id<RLMBSON>> *makeEncoderTestDocument() {
+    return @{
+        @"nil": [NSNull null],
+        @"string": @"test \"string\"\n\twith\\escapes\x01 and ünïcödé",
+        @"true": @YES,
+        @"false": @NO,
+        @"int": @25,
+        @"int64": @(INT64_MAX),
+        @"double": @15.5,
+        @"infinity": @(INFINITY),
+        @"decimal128": [[RLMDecimal128 alloc] initWithString:@"1.2E+10" error:nil],
+        @"minkey": [RLMMinKey new],
+        @"maxkey": [RLMMaxKey new],
+        @"date": [[NSDate alloc] initWithTimeIntervalSince1970:500.25],
+        @"binary": [NSData dataWithBytes:"\x00\x01\x02\x03\xff" length:5],
+        @"nestedarray": @[@[@1, @2], @[@3, @4]],
+        @"nesteddoc": @{@"a": @1, @"b": @2, @"c": @NO, @"d": @[@3, @4], @"e" : @{@"f": @"g"}},
+        @"oid": [[RLMObjectId alloc] initWithString:@"507f1f77bcf86cd799439011" error:nil],
+        @"regex": [[NSRegularExpression alloc] initWithPattern:@"^abc" options:NSRegularExpressionCaseInsensitive error:nil],
+        @"uuid": [[NSUUID alloc] initWithUUIDString:@"b1c11e54-e719-4275-b631-69ec3f2d616d"],
+    };
+}
+
+- (void)testExtendedJSONMatchesBsonConversion {
+    NSDictionary *document = makeEncoderTestDocument();
+    auto json = RLMConvertRLMBSONToExtendedJSON(document);
+    XCTAssertEqual(parse(json), RLMConvertRLMBSONToBson(document));
+
+    NSArray *array = @[document, @[], @{}, @"", [NSDecimalNumber numberWithDouble:1.5]];
+    json = RLMConvertRLMBSONToExtendedJSON(array);
+    XCTAssertEqual(parse(json), RLMConvertRLMBSONToBson(array));
+}
+
+static NSArray *makeInsertManyDocuments() {
+    NSMutableArray *documents = [NSMutableArray new];
+    for (int i = 0; i < 50000; ++i) {
+        [documents addObject:@{
+            @"name": [NSString stringWithFormat:@"name %d", i],
+            @"age": @(i),
+            @"score": @(i * 1.5),
+            @"active": @(i % 2 == 0),
+            @"tags": @[@"a", @"b", @"c"],
+        }];
+    }
+    return documents;
+}
+
+- (void)testBsonThenJSONEncodingPerformance {
+    NSArray *documents = makeInsertManyDocuments();
+    [self measureBlock:^{
+        std::stringstream ss;
+        ss << RLMConvertRLMBSONToBson(documents);
+        (void)ss.str();
+    }];
+}
+
+- (void)testDirectJSONEncodingPerformance {
+    NSArray *documents = makeInsertManyDocuments();
+    [self measureBlock:^{
+        (void)RLMConvertRLMBSONToExtendedJSON(documents);
+    }];
+}
+
 @end
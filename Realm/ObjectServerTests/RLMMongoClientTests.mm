@@ -20,12 +20,14 @@
 #import "RLMUser+ObjectServerTests.h"
 #import "RLMWatchTestUtility.h"
 #import "RLMBSON_Private.hpp"
+#import "RLMMongoCollection_Private.h"
 #import "RLMUser_Private.hpp"
 
 #import <realm/object-store/sync/app_user.hpp>
 #import <realm/object-store/sync/sync_manager.hpp>
 #import <realm/util/bson/bson.hpp>
 
+#import <atomic>
 #import <sstream>
 
 #if TARGET_OS_OSX
@@ -178,6 +180,45 @@
     [self waitForExpectationsWithTimeout:60.0 handler:nil];
 }
 
+- (void)testMongoInsertManyChunked {
+    RLMMongoCollection *collection = [self.anonymousUser collectionForType:Dog.class app:self.app];
+
+    NSMutableArray *documents = [NSMutableArray new];
+    for (int i = 0; i < 25; i++) {
+        [documents addObject:@{@"name": @"fido", @"breed": @"cane corso", @"age": @(i)}];
+    }
+    RLMInsertManyOptions *insertOptions = [RLMInsertManyOptions new];
+    insertOptions.maximumDocumentsPerRequest = 10;
+    insertOptions.maximumConcurrentRequests = 2;
+
+    XCTestExpectation *insertManyExpectation = [self expectationWithDescription:@"should insert documents"];
+    NSMutableArray<NSNumber *> *progress = [NSMutableArray new];
+    [collection insertManyDocuments:documents
+                            options:insertOptions
+                           progress:^(NSUInteger insertedCount, NSUInteger totalCount) {
+        XCTAssertEqual(totalCount, 25U);
+        @synchronized (progress) {
+            [progress addObject:@(insertedCount)];
+        }
+    } completion:^(NSArray<id<RLMBSON>> *objectIds, NSError *error) {
+        XCTAssertNil(error);
+        XCTAssertEqual(objectIds.count, 25U);
+        [insertManyExpectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:60.0 handler:nil];
+    XCTAssertEqualObjects(progress.lastObject, @25);
+    XCTAssertEqual(progress.count, 3U);
+
+    XCTestExpectation *findExpectation = [self expectationWithDescription:@"should find documents"];
+    [collection findWhere:@{@"name": @"fido", @"breed": @"cane corso"}
+               completion:^(NSArray<NSDictionary *> *foundDocuments, NSError *error) {
+        XCTAssertEqual(foundDocuments.count, 25U);
+        XCTAssertNil(error);
+        [findExpectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:60.0 handler:nil];
+}
+
 - (void)testMongoFind {
     RLMMongoCollection *collection = [self.anonymousUser collectionForType:Dog.class app:self.app];
 
@@ -546,6 +587,55 @@
     [self waitForExpectations:@[expectation] timeout:60.0];
 }
 
+- (void)testWatchBatched {
+    [self performBatchedWatchTest:nil];
+}
+
+- (void)testWatchBatchedAsync {
+    // Batches are counted by the delegate, so they need to be delivered serially
+    auto asyncQueue = dispatch_queue_create("io.realm.watchQueue", DISPATCH_QUEUE_SERIAL);
+    [self performBatchedWatchTest:asyncQueue];
+}
+
+- (void)performBatchedWatchTest:(nullable dispatch_queue_t)delegateQueue {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"watch collection and receive 10 change events in batches"];
+
+    RLMMongoCollection *collection = [self.anonymousUser collectionForType:Dog.class app:self.app];
+
+    RLMWatchTestUtility *testUtility =
+        [[RLMWatchTestUtility alloc] initWithChangeEventCount:10
+                                                  expectation:expectation];
+
+    RLMChangeStreamBatchOptions *options = [RLMChangeStreamBatchOptions new];
+    options.maximumBatchSize = 4;
+    options.maximumLatency = 0.5;
+    options.maximumBufferedEvents = 8;
+    RLMChangeStream *changeStream = [collection watchWithMatchFilter:nil
+                                                           filterIds:nil
+                                                        batchOptions:options
+                                                            delegate:testUtility
+                                                       delegateQueue:delegateQueue];
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        WAIT_FOR_SEMAPHORE(testUtility.isOpenSemaphore, 30.0);
+        NSMutableArray *documents = [NSMutableArray new];
+        for (int i = 0; i < 10; i++) {
+            [documents addObject:@{@"name": @"fido"}];
+        }
+        [collection insertManyDocuments:documents completion:^(NSArray<id<RLMBSON>> *objectIds, NSError *error) {
+            XCTAssertNil(error);
+            XCTAssertEqual(objectIds.count, 10U);
+        }];
+        for (int i = 0; i < 10; i++) {
+            WAIT_FOR_SEMAPHORE(testUtility.semaphore, 30.0);
+        }
+        [changeStream close];
+    });
+
+    [self waitForExpectations:@[expectation] timeout:60.0];
+    XCTAssertLessThanOrEqual(testUtility.largestBatchSize, 4U);
+    XCTAssertGreaterThanOrEqual(testUtility.batchCount, 3U);
+}
+
 - (void)testWatchWithMatchFilter {
     [self performWatchWithMatchFilterTest:nil];
 }
@@ -798,4 +888,195 @@ static NSString *oldPathForPartitionValue(RLMUser *user, NSString *oldName) {
 }
 @end
 
+// Tests for chunked inserts which use a stand-in for the server rather than
+// sending the requests
+@interface RLMChunkedInsertTests : XCTestCase
+@end
+
+@implementation RLMChunkedInsertTests {
+    RLMMongoCollection *_collection;
+    // The documents sent in each request, in the order they were sent
+    NSMutableArray<NSArray<NSDictionary *> *> *_requests;
+    std::atomic<int> _requestsInFlight;
+    std::atomic<int> _maxRequestsInFlight;
+    NSUInteger _failingRequest;
+}
+
+- (void)setUp {
+    [super setUp];
+    // The user is only used to send requests, which the function caller replaces
+    _collection = [[RLMMongoCollection alloc] initWithUser:(RLMUser *_Nonnull)nil
+                                               serviceName:@"mongodb1"
+                                              databaseName:@"test_data"
+                                            collectionName:@"Dog"];
+    _requests = [NSMutableArray new];
+    _requestsInFlight = 0;
+    _maxRequestsInFlight = 0;
+    _failingRequest = NSNotFound;
+}
+
+// Responds to each insertMany with each document's "index" field as its id,
+// after a random delay so that requests complete out of order
+- (RLMMongoFunctionCaller)functionCaller {
+    return ^(NSString *name, NSString *arguments, void (^completion)(NSString *, NSError *)) {
+        XCTAssertEqualObjects(name, @"insertMany");
+        NSDictionary *args = ((NSArray *)RLMConvertBsonToRLMBSON(realm::bson::parse(arguments.UTF8String))).firstObject;
+        XCTAssertEqualObjects(args[@"database"], @"test_data");
+        XCTAssertEqualObjects(args[@"collection"], @"Dog");
+        NSArray<NSDictionary *> *documents = args[@"documents"];
+
+        NSUInteger requestIndex;
+        @synchronized (_requests) {
+            requestIndex = _requests.count;
+            [_requests addObject:documents];
+        }
+        int inFlight = ++_requestsInFlight;
+        int previousMax = _maxRequestsInFlight;
+        while (inFlight > previousMax && !_maxRequestsInFlight.compare_exchange_weak(previousMax, inFlight)) {
+        }
+
+        NSMutableArray *ids = [NSMutableArray new];
+        for (NSDictionary *document in documents) {
+            [ids addObject:document[@"index"]];
+        }
+        NSString *response = @(RLMConvertRLMBSONToExtendedJSON(@{@"insertedIds": ids}).c_str());
+        bool fail = requestIndex == _failingRequest;
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, arc4random_uniform(20) * NSEC_PER_MSEC),
+                       dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^{
+            --_requestsInFlight;
+            if (fail) {
+                completion(nil, [NSError errorWithDomain:@"test" code:1 userInfo:nil]);
+            }
+            else {
+                completion(response, nil);
+            }
+        });
+    };
+}
+
+- (NSArray *)documentsWithCount:(int)count padding:(NSUInteger)padding {
+    NSString *padString = [@"" stringByPaddingToLength:padding withString:@"x" startingAtIndex:0];
+    NSMutableArray *documents = [NSMutableArray new];
+    for (int i = 0; i < count; i++) {
+        [documents addObject:@{@"index": @(i), @"padding": padString}];
+    }
+    return documents;
+}
+
+- (NSArray *)insert:(NSArray *)documents options:(RLMInsertManyOptions *)options
+           progress:(NSMutableArray<NSNumber *> *)progress error:(NSError **)error {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"insert"];
+    __block NSArray *result;
+    __block NSError *resultError;
+    [_collection insertManyDocuments:documents options:options progress:^(NSUInteger insertedCount, NSUInteger totalCount) {
+        XCTAssertEqual(totalCount, documents.count);
+        // The operation delivers progress from one thread at a time and hands
+        // off between threads through its lock, so calls to this block never
+        // overlap and it does not need to be synchronized
+        [progress addObject:@(insertedCount)];
+    } functionCaller:self.functionCaller completion:^(NSArray<id<RLMBSON>> *ids, NSError *err) {
+        result = ids;
+        resultError = err;
+        [expectation fulfill];
+    }];
+    [self waitForExpectations:@[expectation] timeout:10.0];
+    if (error) {
+        *error = resultError;
+    }
+    return result;
+}
+
+- (void)testSplitsByDocumentCount {
+    NSArray *documents = [self documentsWithCount:2500 padding:0];
+    RLMInsertManyOptions *options = [RLMInsertManyOptions new];
+    options.maximumDocumentsPerRequest = 1000;
+    options.maximumConcurrentRequests = 2;
+
+    NSMutableArray<NSNumber *> *progress = [NSMutableArray new];
+    NSError *error;
+    NSArray *ids = [self insert:documents options:options progress:progress error:&error];
+    XCTAssertNil(error);
+
+    XCTAssertEqual(_requests.count, 3U);
+    XCTAssertEqual(_requests[0].count, 1000U);
+    XCTAssertEqual(_requests[1].count, 1000U);
+    XCTAssertEqual(_requests[2].count, 500U);
+    XCTAssertEqual(_maxRequestsInFlight.load(), 2);
+
+    // Ids are in document order even if the requests completed out of order
+    XCTAssertEqual(ids.count, 2500U);
+    for (int i = 0; i < 2500; i++) {
+        XCTAssertEqualObjects(ids[i], @(i));
+    }
+
+    XCTAssertEqual(progress.count, 3U);
+    XCTAssertLessThan(progress[0].intValue, progress[1].intValue);
+    XCTAssertLessThan(progress[1].intValue, progress[2].intValue);
+    XCTAssertEqualObjects(progress.lastObject, @2500);
+}
+
+- (void)testSplitsByByteSize {
+    NSArray *documents = [self documentsWithCount:100 padding:1000];
+    RLMInsertManyOptions *options = [RLMInsertManyOptions new];
+    options.maximumBytesPerRequest = 10'000;
+
+    NSError *error;
+    NSArray *ids = [self insert:documents options:options progress:nil error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqual(ids.count, 100U);
+
+    NSUInteger total = 0;
+    for (NSArray *request in _requests) {
+        XCTAssertGreaterThan(request.count, 0U);
+        XCTAssertLessThan(request.count, 10U);
+        XCTAssertLessThanOrEqual(RLMConvertRLMBSONToExtendedJSON(request).size(), 10'002U);
+        total += request.count;
+    }
+    XCTAssertEqual(total, 100U);
+    XCTAssertLessThanOrEqual(_maxRequestsInFlight.load(), 4);
+}
+
+- (void)testOversizedDocumentIsSentAlone {
+    NSArray *documents = [self documentsWithCount:3 padding:1000];
+    RLMInsertManyOptions *options = [RLMInsertManyOptions new];
+    options.maximumBytesPerRequest = 100;
+
+    NSError *error;
+    NSArray *ids = [self insert:documents options:options progress:nil error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(ids, (@[@0, @1, @2]));
+    XCTAssertEqual(_requests.count, 3U);
+}
+
+- (void)testStopsSendingAfterError {
+    NSArray *documents = [self documentsWithCount:50 padding:0];
+    RLMInsertManyOptions *options = [RLMInsertManyOptions new];
+    options.maximumDocumentsPerRequest = 10;
+    options.maximumConcurrentRequests = 1;
+    _failingRequest = 1;
+
+    NSError *error;
+    NSArray *ids = [self insert:documents options:options progress:nil error:&error];
+    XCTAssertNil(ids);
+    XCTAssertEqualObjects(error.domain, @"test");
+    XCTAssertEqual(_requests.count, 2U);
+}
+
+- (void)testEmptyInsert {
+    NSError *error;
+    NSArray *ids = [self insert:@[] options:[RLMInsertManyOptions new] progress:nil error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(ids, @[]);
+    XCTAssertEqual(_requests.count, 0U);
+}
+
+- (void)testInvalidOptions {
+    RLMInsertManyOptions *options = [RLMInsertManyOptions new];
+    options.maximumConcurrentRequests = 0;
+    XCTAssertThrows([_collection insertManyDocuments:@[@{}] options:options progress:nil
+                                      functionCaller:self.functionCaller
+                                          completion:^(NSArray *, NSError *) {}]);
+}
+@end
+
 #endif // TARGET_OS_OSX
@@ -23,10 +23,14 @@
 RLM_HEADER_AUDIT_BEGIN(nullability, sendability)
 
 /// Used to process watch change events and assert tests.
-@interface RLMWatchTestUtility : XCTestCase <RLMChangeEventDelegate>
+@interface RLMWatchTestUtility : XCTestCase <RLMChangeEventDelegate, RLMChangeEventBatchDelegate>
 
 @property (nonatomic, strong) dispatch_semaphore_t semaphore;
 @property (nonatomic, strong) dispatch_semaphore_t isOpenSemaphore;
+/// The number of batches received when used as a batched delegate.
+@property (nonatomic, readonly) NSUInteger batchCount;
+/// The largest batch received when used as a batched delegate.
+@property (nonatomic, readonly) NSUInteger largestBatchSize;
 
 /// Sets up an object that subscribes to the RLMChangeEventDelegate
 /// @param changeEventCount The target amount of change events for the test to succeed
@@ -77,6 +77,15 @@
     }
 }
 
+- (void)changeStreamDidReceiveChangeEvents:(nonnull NSArray<id<RLMBSON>> *)changeEvents {
+    XCTAssertGreaterThan(changeEvents.count, 0U);
+    _batchCount++;
+    _largestBatchSize = MAX(_largestBatchSize, changeEvents.count);
+    for (id<RLMBSON> changeEvent in changeEvents) {
+        [self changeStreamDidReceiveChangeEvent:changeEvent];
+    }
+}
+
 - (void)changeStreamDidReceiveError:(nonnull NSError *)error {
     XCTAssertNil(error);
 }
@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#if os(macOS)
+
+import Foundation
+import Network
+
+// A minimal local HTTP/1.1 server which answers every request with the same
+// keep-alive response. Used as a stand-in for the server when testing and
+// benchmarking the network transport itself.
+@available(OSX 10.14, *)
+@objc(StubHTTPServer)
+public class StubHTTPServer: NSObject, @unchecked Sendable {
+    let port: NWEndpoint.Port
+    let responseBody: Data
+
+    let queue = DispatchQueue(label: "StubHTTPServer")
+    var listener: NWListener!
+    var connections = [NWConnection]()
+
+    private var _acceptedConnections = 0
+    /// The number of TCP connections which have been accepted.
+    @objc public var acceptedConnections: Int {
+        queue.sync { _acceptedConnections }
+    }
+
+    private var _requestCount = 0
+    /// The number of requests which have been responded to.
+    @objc public var requestCount: Int {
+        queue.sync { _requestCount }
+    }
+
+    @objc public init(port: UInt16, responseBody: String = "{}") {
+        self.port = NWEndpoint.Port(rawValue: port)!
+        self.responseBody = responseBody.data(using: .utf8)!
+    }
+
+    @objc public var url: String {
+        "http://localhost:\(port.rawValue)"
+    }
+
+    @objc public func start() throws {
+        listener = try NWListener(using: NWParameters.tcp, on: port)
+        listener.newConnectionHandler = { @Sendable [weak self] connection in
+            guard let self = self else { return }
+            self.connections.append(connection)
+            self._acceptedConnections += 1
+            connection.start(queue: self.queue)
+            self.receive(on: connection, buffer: Data())
+        }
+        let ready = DispatchSemaphore(value: 0)
+        listener.stateUpdateHandler = { state in
+            switch state {
+            case .ready, .failed, .cancelled:
+                ready.signal()
+            default:
+                break
+            }
+        }
+        listener.start(queue: queue)
+        ready.wait()
+    }
+
+    @objc public func stop() {
+        listener.cancel()
+        queue.sync {
+            for connection in connections {
+                connection.forceCancel()
+            }
+        }
+    }
+
+    private func receive(on connection: NWConnection, buffer: Data) {
+        connection.receive(minimumIncompleteLength: 1, maximumLength: 65536) { [weak self] data, _, isComplete, error in
+            guard let self = self, error == nil else { return }
+            var buffer = buffer
+            if let data = data {
+                buffer.append(data)
+            }
+            while let length = Self.completeRequestLength(buffer) {
+                buffer = Data(buffer.dropFirst(length))
+                self.respond(on: connection)
+            }
+            if !isComplete {
+                self.receive(on: connection, buffer: buffer)
+            }
+        }
+    }
+
+    private func respond(on connection: NWConnection) {
+        _requestCount += 1
+        var response = Data("""
+            HTTP/1.1 200 OK\r
+            Content-Type: application/json\r
+            Content-Length: \(responseBody.count)\r
+            Connection: keep-alive\r
+            \r
+
+            """.utf8)
+        response.append(responseBody)
+        connection.send(content: response, completion: .idempotent)
+    }
+
+    // Returns the length of the first request in the buffer if it has been
+    // fully received, including any body indicated by Content-Length
+    private static func completeRequestLength(_ buffer: Data) -> Int? {
+        guard let headerEnd = buffer.range(of: Data("\r\n\r\n".utf8)) else {
+            return nil
+        }
+        let headers = String(decoding: buffer[buffer.startIndex..<headerEnd.lowerBound], as: UTF8.self)
+        var bodyLength = 0
+        for line in headers.split(separator: "\r\n") {
+            let parts = line.split(separator: ":", maxSplits: 1)
+            if parts.count == 2 && parts[0].lowercased() == "content-length" {
+                bodyLength = Int(parts[1].trimmingCharacters(in: .whitespaces)) ?? 0
+            }
+        }
+        let length = headerEnd.upperBound - buffer.startIndex + bodyLength
+        return buffer.count >= length ? length : nil
+    }
+}
+
+#endif // os(macOS)
@@ -1387,4 +1387,120 @@ class SwiftObjectServerTests: SwiftSyncTestCase {
     }
 }
 
+// These run against a local stand-in server rather than BaaS, so they measure
+// only the cost of the transport and connection setup.
+@available(macOS 13.0, *)
+class NetworkTransportTests: XCTestCase {
+    var server: StubHTTPServer!
+
+    override func setUp() {
+        super.setUp()
+        server = StubHTTPServer(port: 5679)
+        try! server.start()
+    }
+
+    override func tearDown() {
+        server.stop()
+        super.tearDown()
+    }
+
+    func sendRequests(_ transport: RLMNetworkTransport, count: Int) {
+        for _ in 0..<count {
+            let ex = expectation(description: "request")
+            let request = RLMRequest()
+            request.method = .POST
+            request.url = "\(server.url)/api/client/v2.0/app/test/functions/call"
+            request.timeout = 60
+            request.headers = ["Content-Type": "application/json"]
+            request.body = #"{"name":"sum","arguments":[1,2]}"#
+            transport.sendRequest(toServer: request) { response in
+                XCTAssertEqual(response.httpStatusCode, 200)
+                XCTAssertEqual(response.body, "{}")
+                ex.fulfill()
+            }
+            wait(for: [ex], timeout: 10)
+        }
+    }
+
+    func testPerRequestSessions() {
+        let transport = RLMNetworkTransport()
+        XCTAssertFalse(transport.usesPersistentConnections)
+        sendRequests(transport, count: 10)
+
+        let statistics = transport.statistics
+        XCTAssertEqual(statistics.sessionsCreated, 10)
+        XCTAssertEqual(statistics.requestsCompleted, 10)
+        XCTAssertEqual(statistics.reusedConnections, 0)
+        XCTAssertEqual(server.acceptedConnections, 10)
+    }
+
+    func testPersistentConnections() {
+        let transport = RLMNetworkTransport(persistentConnections: true)
+        XCTAssertTrue(transport.usesPersistentConnections)
+        sendRequests(transport, count: 10)
+
+        let statistics = transport.statistics
+        XCTAssertEqual(statistics.sessionsCreated, 1)
+        XCTAssertEqual(statistics.requestsCompleted, 10)
+        XCTAssertEqual(statistics.reusedConnections, 9)
+        XCTAssertEqual(server.acceptedConnections, 1)
+        XCTAssertEqual(server.requestCount, 10)
+    }
+
+    func testPersistentConnectionsUseSessionPerServer() {
+        let other = StubHTTPServer(port: 5680)
+        try! other.start()
+        defer { other.stop() }
+
+        let transport = RLMNetworkTransport(persistentConnections: true)
+        sendRequests(transport, count: 2)
+        let ex = expectation(description: "request")
+        let request = RLMRequest()
+        request.url = "\(other.url)/api/client/v2.0/location"
+        request.timeout = 60
+        transport.sendRequest(toServer: request) { response in
+            XCTAssertEqual(response.httpStatusCode, 200)
+            ex.fulfill()
+        }
+        wait(for: [ex], timeout: 10)
+
+        XCTAssertEqual(transport.statistics.sessionsCreated, 2)
+        XCTAssertEqual(other.requestCount, 1)
+    }
+
+    func testLargeResponseBody() {
+        let body = "[" + Array(repeating: #"{"_id":1,"name":"a document"}"#, count: 100_000).joined(separator: ",") + "]"
+        let largeServer = StubHTTPServer(port: 5680, responseBody: body)
+        try! largeServer.start()
+        defer { largeServer.stop() }
+
+        for transport in [RLMNetworkTransport(), RLMNetworkTransport(persistentConnections: true)] {
+            let ex = expectation(description: "request")
+            let request = RLMRequest()
+            request.url = "\(largeServer.url)/api/client/v2.0/app/test/functions/call"
+            request.timeout = 60
+            transport.sendRequest(toServer: request) { response in
+                XCTAssertEqual(response.httpStatusCode, 200)
+                XCTAssertEqual(response.body, body)
+                ex.fulfill()
+            }
+            wait(for: [ex], timeout: 10)
+        }
+    }
+
+    func testPerRequestSessionsPerformance() {
+        let transport = RLMNetworkTransport()
+        measure {
+            sendRequests(transport, count: 100)
+        }
+    }
+
+    func testPersistentConnectionsPerformance() {
+        let transport = RLMNetworkTransport(persistentConnections: true)
+        measure {
+            sendRequests(transport, count: 100)
+        }
+    }
+}
+
 #endif // os(macOS)
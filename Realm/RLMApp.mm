@@ -29,6 +29,7 @@
 #import "RLMCredentials_Private.hpp"
 #import "RLMEmailPasswordAuth.h"
 #import "RLMLogger.h"
+#import "RLMNetworkTransport_Private.hpp"
 #import "RLMProviderClient_Private.hpp"
 #import "RLMPushClient_Private.hpp"
 #import "RLMSyncManager_Private.hpp"
@@ -81,7 +82,7 @@ namespace {
                     .http_status_code = static_cast<int>(response.httpStatusCode),
                     .custom_status_code = static_cast<int>(response.customStatusCode),
                     .headers = bridgingHeaders,
-                    .body = response.body ? response.body.UTF8String : ""
+                    .body = [response takeBody]
                 });
             }];
         }
@@ -237,6 +237,63 @@ RLM_HEADER_AUDIT_BEGIN(nullability, sendability)
  */
 - (void)exchangeObjectAtIndex:(NSUInteger)index1 withObjectAtIndex:(NSUInteger)index2;
 
+/**
+ Replaces the objects in the given range with the objects in the given array.
+
+ The array's size changes if `objects` does not contain exactly `range.length`
+ objects. All objects are validated before the array is modified, and
+ observers receive a single change notification for the whole replacement.
+
+ Throws an exception if the range exceeds the bounds of the array.
+
+ @warning This method may only be called during a write transaction.
+
+ @param range   The range of objects to be replaced.
+ @param objects The objects to insert in place of the range.
+ */
+- (void)replaceObjectsInRange:(NSRange)range withObjects:(NSArray<RLMObjectType> *)objects;
+
+/**
+ Reorders the objects in the array so that the object at index `i` is the
+ object which was previously at index `indexes[i]`.
+
+ This performs the minimum number of exchanges needed to reorder the array
+ and sends a single change notification, which is much faster than moving
+ objects one at a time.
+
+ Throws an exception if `indexes` is not a permutation of the array's indexes.
+
+ @warning This method may only be called during a write transaction.
+
+ @param indexes The previous index of each object in the new order.
+ */
+- (void)reorderObjectsWithIndexes:(NSArray<NSNumber *> *)indexes;
+
+/**
+ Removes all objects in the array which match the given predicate.
+
+ @warning This method may only be called during a write transaction.
+
+ @param predicateFormat A predicate format string, optionally followed by a variable number of arguments.
+ */
+- (void)removeObjectsWhere:(NSString *)predicateFormat, ...;
+
+/// :nodoc:
+- (void)removeObjectsWhere:(NSString *)predicateFormat args:(va_list)args;
+
+/**
+ Removes all objects in the array which match the given predicate.
+
+ Matching objects are removed from the array in a single pass and observers
+ receive a single change notification. The objects themselves are not
+ deleted from the Realm.
+
+ @warning This method may only be called during a write transaction.
+
+ @param predicate The predicate with which to filter the objects.
+ */
+- (void)removeObjectsWithPredicate:(NSPredicate *)predicate;
+
 #pragma mark - Querying an Array
 
 /**
@@ -599,6 +656,44 @@ __attribute__((warn_unused_result));
  */
 - (nullable NSNumber *)averageOfProperty:(NSString *)property;
 
+#pragma mark - Reading Property Values
+
+/**
+ Returns the values of the given property for each object in the array, packed
+ into a buffer of consecutive `int64_t` values in the same order as the objects.
+
+     NSData *ages = [object.arrayProperty int64ValuesOfProperty:@"age"];
+     const int64_t *values = ages.bytes;
+
+ The values are read directly from the Realm without creating an object or
+ `NSNumber` for each value, which makes this much faster than `valueForKey:`
+ for reading a single property of many objects.
+
+ @param property The property whose values are desired. Only non-optional `int`
+                 properties are supported.
+
+ @return A buffer containing one `int64_t` value for each object.
+ */
+- (NSData *)int64ValuesOfProperty:(NSString *)property;
+
+/**
+ Returns the values of the given property for each object in the array, packed
+ into a buffer of consecutive `double` values in the same order as the objects.
+
+     NSData *prices = [object.arrayProperty doubleValuesOfProperty:@"price"];
+     const double *values = prices.bytes;
+
+ The values are read directly from the Realm without creating an object or
+ `NSNumber` for each value. `int` and `float` values are converted to `double`,
+ dates are stored as seconds since 1970, and `nil` values are stored as NaN.
+
+ @param property The property whose values are desired. Only properties of
+                 types `int`, `float`, `double`, and `NSDate` are supported.
+
+ @return A buffer containing one `double` value for each object.
+ */
+- (NSData *)doubleValuesOfProperty:(NSString *)property;
+
 #pragma mark - Freeze
 
 /**
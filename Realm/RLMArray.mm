@@ -117,6 +117,18 @@
                                                                    arguments:args]];
 }
 
+- (void)removeObjectsWhere:(NSString *)predicateFormat, ... {
+    va_list args;
+    va_start(args, predicateFormat);
+    [self removeObjectsWhere:predicateFormat args:args];
+    va_end(args);
+}
+
+- (void)removeObjectsWhere:(NSString *)predicateFormat args:(va_list)args {
+    [self removeObjectsWithPredicate:[NSPredicate predicateWithFormat:predicateFormat
+                                                            arguments:args]];
+}
+
 // The compiler complains about the method's argument type not matching due to
 // it not having the generic type attached, but it doesn't seem to be possible
 // to actually include the generic type
@@ -191,6 +203,12 @@ static void changeArray(__unsafe_unretained RLMArray *const ar,
     }
 
     if (RLMObjectBase *parent = ar->_parentObject) {
+        if (kind == NSKeyValueChangeSetting) {
+            [parent willChangeValueForKey:ar->_property.name];
+            f();
+            [parent didChangeValueForKey:ar->_property.name];
+            return;
+        }
         NSIndexSet *indexes = is();
         [parent willChange:kind valuesAtIndexes:indexes forKey:ar->_property.name];
         f();
@@ -245,6 +263,39 @@ void RLMArrayValidateMatchingObjectType(__unsafe_unretained RLMArray *const arra
     }
 }
 
+void RLMArrayValidateRange(NSRange range, NSUInteger count) {
+    if (range.location > count || range.length > count - range.location) {
+        @throw RLMException(@"Range {%llu, %llu} is out of bounds (must be within {0, %llu}).",
+                            (unsigned long long)range.location, (unsigned long long)range.length,
+                            (unsigned long long)count);
+    }
+}
+
+std::vector<size_t> RLMArrayValidatePermutation(NSArray<NSNumber *> *indexes, NSUInteger count) {
+    if (indexes.count != count) {
+        @throw RLMException(@"Reordering an array of %llu objects requires %llu indexes, but %llu were given.",
+                            (unsigned long long)count, (unsigned long long)count,
+                            (unsigned long long)indexes.count);
+    }
+    std::vector<size_t> permutation;
+    permutation.reserve(count);
+    std::vector<bool> seen(count);
+    for (NSNumber *number in indexes) {
+        NSUInteger index = number.unsignedIntegerValue;
+        if (index >= count) {
+            @throw RLMException(@"Index %llu is out of bounds (must be less than %llu).",
+                                (unsigned long long)index, (unsigned long long)count);
+        }
+        if (seen[index]) {
+            @throw RLMException(@"Index %llu appears more than once in the new order.",
+                                (unsigned long long)index);
+        }
+        seen[index] = true;
+        permutation.push_back(index);
+    }
+    return permutation;
+}
+
 static void validateArrayBounds(__unsafe_unretained RLMArray *const ar,
                                    NSUInteger index, bool allowOnePastEnd=false) {
     NSUInteger max = ar->_backingCollection.count + allowOnePastEnd;
@@ -329,6 +380,55 @@ static void validateArrayBounds(__unsafe_unretained RLMArray *const ar,
     });
 }
 
+- (void)replaceObjectsInRange:(NSRange)range withObjects:(NSArray *)objects {
+    for (id obj in objects) {
+        RLMArrayValidateMatchingObjectType(self, obj);
+    }
+    RLMArrayValidateRange(range, _backingCollection.count);
+    if (!range.length && !objects.count) {
+        return;
+    }
+    if (range.length == objects.count) {
+        changeArray(self, NSKeyValueChangeReplacement, range, ^{
+            [_backingCollection replaceObjectsInRange:range withObjectsFromArray:objects];
+        });
+        return;
+    }
+    changeArray(self, NSKeyValueChangeSetting, ^{
+        [_backingCollection replaceObjectsInRange:range withObjectsFromArray:objects];
+    }, [] { return (NSIndexSet *)nil; });
+}
+
+- (void)reorderObjectsWithIndexes:(NSArray<NSNumber *> *)indexes {
+    auto permutation = RLMArrayValidatePermutation(indexes, _backingCollection.count);
+    NSMutableIndexSet *changed = [NSMutableIndexSet new];
+    NSMutableArray *reordered = [[NSMutableArray alloc] initWithCapacity:permutation.size()];
+    for (size_t i = 0; i < permutation.size(); ++i) {
+        if (permutation[i] != i) {
+            [changed addIndex:i];
+        }
+        [reordered addObject:_backingCollection[permutation[i]]];
+    }
+    if (!changed.count) {
+        return;
+    }
+    changeArray(self, NSKeyValueChangeReplacement, changed, ^{
+        [_backingCollection setArray:reordered];
+    });
+}
+
+- (void)removeObjectsWithPredicate:(NSPredicate *)predicate {
+    NSIndexSet *indexes = [_backingCollection indexesOfObjectsPassingTest:^BOOL(id obj, NSUInteger, BOOL *) {
+        return [predicate evaluateWithObject:obj];
+    }];
+    if (!indexes.count) {
+        return;
+    }
+    changeArray(self, NSKeyValueChangeRemoval, indexes, ^{
+        [_backingCollection removeObjectsAtIndexes:indexes];
+    });
+}
+
 - (NSUInteger)indexOfObject:(id)object {
     RLMArrayValidateMatchingObjectType(self, object);
     if (!_backingCollection) {
@@ -382,20 +482,18 @@ static void validateArrayBounds(__unsafe_unretained RLMArray *const ar,
     return [self objectsWithPredicate:[NSPredicate predicateWithFormat:predicateFormat arguments:args]];
 }
 
+- (RLMObjectSchema *)elementObjectSchema {
+    if (_backingCollection.count) {
+        return [_backingCollection[0] objectSchema];
+    }
+    return [RLMSchema.partialPrivateSharedSchema schemaForClassName:_objectClassName];
+}
+
 - (RLMPropertyType)typeForProperty:(NSString *)propertyName {
     if ([propertyName isEqualToString:@"self"]) {
         return _type;
     }
-
-    RLMObjectSchema *objectSchema;
-    if (_backingCollection.count) {
-        objectSchema = [_backingCollection[0] objectSchema];
-    }
-    else {
-        objectSchema = [RLMSchema.partialPrivateSharedSchema schemaForClassName:_objectClassName];
-    }
-
-    return RLMValidatedProperty(objectSchema, propertyName).type;
+    return RLMValidatedProperty(self.elementObjectSchema, propertyName).type;
 }
 
 - (id)aggregateProperty:(NSString *)key operation:(NSString *)op method:(SEL)sel {
@@ -507,6 +605,48 @@ static void validateArrayBounds(__unsafe_unretained RLMArray *const ar,
     return [self aggregateProperty:property operation:@"@avg" method:_cmd];
 }
 
+- (NSData *)packedValuesOfProperty:(NSString *)property asDouble:(bool)asDouble method:(SEL)method {
+    if (_type != RLMPropertyTypeObject) {
+        @throw RLMException(@"%@ is only supported for collections of objects",
+                            NSStringFromSelector(method));
+    }
+    RLMValidatedPackedValuesProperty(self.elementObjectSchema, property, asDouble, method);
+
+    NSUInteger count = _backingCollection.count;
+    NSMutableData *data = [NSMutableData dataWithLength:count * (asDouble ? sizeof(double) : sizeof(int64_t))];
+    NSUInteger i = 0;
+    if (asDouble) {
+        auto values = static_cast<double *>(data.mutableBytes);
+        for (RLMObjectBase *object in _backingCollection) {
+            id value = [object valueForKey:property];
+            if (!value || value == NSNull.null) {
+                values[i++] = NAN;
+            }
+            else if ([value isKindOfClass:[NSDate class]]) {
+                values[i++] = [(NSDate *)value timeIntervalSince1970];
+            }
+            else {
+                values[i++] = [(NSNumber *)value doubleValue];
+            }
+        }
+    }
+    else {
+        auto values = static_cast<int64_t *>(data.mutableBytes);
+        for (RLMObjectBase *object in _backingCollection) {
+            values[i++] = [[object valueForKey:property] longLongValue];
+        }
+    }
+    return data;
+}
+
+- (NSData *)int64ValuesOfProperty:(NSString *)property {
+    return [self packedValuesOfProperty:property asDouble:false method:_cmd];
+}
+
+- (NSData *)doubleValuesOfProperty:(NSString *)property {
+    return [self packedValuesOfProperty:property asDouble:true method:_cmd];
+}
+
 - (NSUInteger)indexOfObjectWithPredicate:(NSPredicate *)predicate {
     if (!_backingCollection) {
         return NSNotFound;
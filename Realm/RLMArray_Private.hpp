@@ -24,6 +24,8 @@
 
 #import <realm/table_ref.hpp>
 
+#import <vector>
+
 namespace realm {
     class Results;
 }
@@ -59,6 +61,12 @@ class RLMObservationInfo;
 
 void RLMValidateArrayObservationKey(NSString *keyPath, RLMArray *array);
 
+// Throw if the range is not within an array of the given size
+void RLMArrayValidateRange(NSRange range, NSUInteger count);
+// Convert the indexes passed to -reorderObjectsWithIndexes: to a vector,
+// throwing if they aren't a permutation of [0, count)
+std::vector<size_t> RLMArrayValidatePermutation(NSArray<NSNumber *> *indexes, NSUInteger count);
+
 // Initialize the observation info for an array if needed
 void RLMEnsureArrayObservationInfo(std::unique_ptr<RLMObservationInfo>& info,
                                    NSString *keyPath, RLMArray *array, id observed);
@@ -172,3 +172,28 @@ RLM_SWIFT_SENDABLE RLM_FINAL
 /// :nodoc:
 @interface NSUUID (RLMBSON)<RLMBSON>
 @end
+
+#pragma mark RLMBSONDocument
+
+/**
+ A read-only BSON document received from the server.
+
+ Documents returned by `RLMMongoCollection` queries are instances of this class
+ rather than being converted to an `NSDictionary` when they are received. Each
+ field is converted to an Objective-C value the first time it is read, and long
+ string and binary values refer to the received data rather than copying it.
+ Nested documents and arrays are `RLMBSONDocument` and `RLMBSONArray`.
+ */
+RLM_SWIFT_SENDABLE RLM_FINAL
+@interface RLMBSONDocument : NSDictionary<NSString *, id<RLMBSON>>
+@end
+
+/**
+ A read-only BSON array received from the server, which converts each element
+ to an Objective-C value the first time it is read.
+
+ @see RLMBSONDocument
+ */
+RLM_SWIFT_SENDABLE RLM_FINAL
+@interface RLMBSONArray : NSArray<id<RLMBSON>>
+@end
@@ -25,6 +25,10 @@
 
 #import <realm/util/bson/bson.hpp>
 
+#import <charconv>
+#import <objc/runtime.h>
+#import <unordered_map>
+
 using namespace realm;
 using namespace bson;
 
@@ -365,6 +369,320 @@ BsonDocument RLMConvertRLMBSONArrayToBsonDocument(NSArray<id<RLMBSON>> *array) {
     return bsonDocument;
 }
 
+#pragma mark RLMBSONToExtendedJSON
+
+namespace {
+// Writes canonical extended JSON directly from Objective-C values, producing
+// the same output as converting to Bson and then serializing that.
+class ExtendedJSONWriter {
+public:
+    ExtendedJSONWriter(std::string& out) : m_out(out) { }
+
+    void write(id<RLMBSON> value) {
+        switch (typeOf(value)) {
+            case RLMBSONTypeNull:
+                m_out += "null";
+                break;
+            case RLMBSONTypeBool:
+                m_out += ((NSNumber *)value).boolValue ? "true" : "false";
+                break;
+            case RLMBSONTypeInt32:
+                writeWrapped("{\"$numberInt\":\"", ((NSNumber *)value).intValue, "\"}");
+                break;
+            case RLMBSONTypeInt64:
+                writeWrapped("{\"$numberLong\":\"", ((NSNumber *)value).longLongValue, "\"}");
+                break;
+            case RLMBSONTypeDouble:
+                writeDouble(((NSNumber *)value).doubleValue);
+                break;
+            case RLMBSONTypeString:
+                writeString((__bridge CFStringRef)value);
+                break;
+            case RLMBSONTypeBinary: {
+                NSData *data = (NSData *)value;
+                writeBinary(static_cast<const uint8_t *>(data.bytes), data.length, "00");
+                break;
+            }
+            case RLMBSONTypeTimestamp:
+                writeWrapped("{\"$timestamp\":{\"t\":", (int64_t)((NSDate *)value).timeIntervalSince1970, ",\"i\":0}}");
+                break;
+            case RLMBSONTypeDatetime: {
+                auto timestamp = RLMTimestampForNSDate((NSDate *)value);
+                int64_t millis = timestamp.get_seconds() * 1000 + timestamp.get_nanoseconds() / 1'000'000;
+                writeWrapped("{\"$date\":{\"$numberLong\":\"", millis, "\"}}");
+                break;
+            }
+            case RLMBSONTypeObjectId:
+                m_out += "{\"$oid\":\"";
+                m_out += ((RLMObjectId *)value).value.to_string();
+                m_out += "\"}";
+                break;
+            case RLMBSONTypeDecimal128:
+                m_out += "{\"$numberDecimal\":\"";
+                m_out += [(RLMDecimal128 *)value decimal128Value].to_string();
+                m_out += "\"}";
+                break;
+            case RLMBSONTypeRegularExpression: {
+                // Options are mapped the same way as -regularExpressionValue
+                NSRegularExpression *regex = (NSRegularExpression *)value;
+                NSRegularExpressionOptions options = regex.options;
+                m_out += "{\"$regularExpression\":{\"pattern\":";
+                writeString((__bridge CFStringRef)regex.pattern);
+                m_out += ",\"options\":\"";
+                if (options & NSRegularExpressionCaseInsensitive) m_out += 'i';
+                if (options & NSRegularExpressionUseUnixLineSeparators) m_out += 'm';
+                if (options & NSRegularExpressionDotMatchesLineSeparators) m_out += 's';
+                if (options & NSRegularExpressionUseUnicodeWordBoundaries) m_out += 'x';
+                m_out += "\"}}";
+                break;
+            }
+            case RLMBSONTypeMaxKey:
+                m_out += "{\"$maxKey\":1}";
+                break;
+            case RLMBSONTypeMinKey:
+                m_out += "{\"$minKey\":1}";
+                break;
+            case RLMBSONTypeDocument: {
+                m_out += '{';
+                bool first = true;
+                [(NSDictionary *)value enumerateKeysAndObjectsUsingBlock:[&](NSString *key, id<RLMBSON> child, BOOL *) {
+                    if (!first) {
+                        m_out += ',';
+                    }
+                    first = false;
+                    writeString((__bridge CFStringRef)key);
+                    m_out += ':';
+                    write(child);
+                }];
+                m_out += '}';
+                break;
+            }
+            case RLMBSONTypeArray: {
+                m_out += '[';
+                bool first = true;
+                for (id<RLMBSON> child in (NSArray *)value) {
+                    if (!first) {
+                        m_out += ',';
+                    }
+                    first = false;
+                    write(child);
+                }
+                m_out += ']';
+                break;
+            }
+            case RLMBSONTypeUUID: {
+                uuid_t bytes;
+                [(NSUUID *)value getUUIDBytes:bytes];
+                writeBinary(bytes, sizeof(bytes), "04");
+                break;
+            }
+        }
+    }
+
+private:
+    std::string& m_out;
+    std::string m_scratch;
+
+    // How the BSON type of instances of a class is determined. Every class
+    // other than NSNumber has a single BSON type, so it only needs to be
+    // looked up once per class rather than once per value.
+    enum class TypeSource : uint8_t {
+        Class,    // All instances have the cached type
+        CFNumber, // Toll-free bridged NSNumber; checked with CFNumberGetType()
+        Instance, // Some other NSNumber subclass; ask the instance
+    };
+    struct CachedType {
+        Class cls;
+        TypeSource source;
+        RLMBSONType type;
+    };
+    // Documents typically contain only a handful of distinct classes, so a
+    // linear scan is faster than hashing
+    std::vector<CachedType> m_types;
+
+    RLMBSONType typeOf(id<RLMBSON> value) {
+        Class cls = object_getClass(value);
+        for (auto& cached : m_types) {
+            if (cached.cls == cls) {
+                return typeOf(value, cached);
+            }
+        }
+        return typeOf(value, m_types.emplace_back(cachedTypeFor(value, cls)));
+    }
+
+    static RLMBSONType typeOf(id<RLMBSON> value, const CachedType& cached) {
+        switch (cached.source) {
+            case TypeSource::Class:
+                return cached.type;
+            case TypeSource::CFNumber:
+                return typeOfNumber((__bridge CFNumberRef)value);
+            case TypeSource::Instance:
+                return value.bsonType;
+        }
+        REALM_UNREACHABLE();
+    }
+
+    static CachedType cachedTypeFor(id<RLMBSON> value, Class cls) {
+        static Class cfNumberClass = object_getClass(@0);
+        static Class cfBooleanClass = object_getClass(@YES);
+        if (cls == cfNumberClass) {
+            return {cls, TypeSource::CFNumber, RLMBSONTypeDouble};
+        }
+        if (cls != cfBooleanClass && [(id)value isKindOfClass:[NSNumber class]]) {
+            return {cls, TypeSource::Instance, RLMBSONTypeDouble};
+        }
+        return {cls, TypeSource::Class, value.bsonType};
+    }
+
+    // Matches -[NSNumber bsonType], which is based on the objCType that
+    // CFNumber reports for each of its storage types
+    static RLMBSONType typeOfNumber(CFNumberRef number) {
+        switch (CFNumberGetType(number)) {
+            case kCFNumberSInt8Type:
+            case kCFNumberCharType:
+                return RLMBSONTypeBool;
+            case kCFNumberSInt16Type:
+            case kCFNumberSInt32Type:
+            case kCFNumberShortType:
+            case kCFNumberIntType:
+                return RLMBSONTypeInt32;
+            case kCFNumberSInt64Type:
+            case kCFNumberLongType:
+            case kCFNumberLongLongType:
+            case kCFNumberCFIndexType:
+            case kCFNumberNSIntegerType:
+                return RLMBSONTypeInt64;
+            default:
+                return RLMBSONTypeDouble;
+        }
+    }
+
+    template <typename T>
+    void writeWrapped(const char *prefix, T value, const char *suffix) {
+        char buffer[24];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        m_out += prefix;
+        m_out.append(buffer, result.ptr);
+        m_out += suffix;
+    }
+
+    void writeDouble(double value) {
+        m_out += "{\"$numberDouble\":\"";
+        if (std::isnan(value)) {
+            m_out += "NaN";
+        }
+        else if (std::isinf(value)) {
+            m_out += value > 0 ? "Infinity" : "-Infinity";
+        }
+        else {
+            char buffer[32];
+            int length = snprintf(buffer, sizeof(buffer), "%.17g", value);
+            m_out.append(buffer, length);
+        }
+        m_out += "\"}";
+    }
+
+    void writeString(CFStringRef string) {
+        if (const char *utf8 = CFStringGetCStringPtr(string, kCFStringEncodingUTF8)) {
+            return writeString(std::string_view(utf8));
+        }
+        CFIndex length = CFStringGetLength(string);
+        CFIndex maxSize = CFStringGetMaximumSizeForEncoding(length, kCFStringEncodingUTF8);
+        m_scratch.resize(maxSize);
+        CFIndex used = 0;
+        CFStringGetBytes(string, CFRangeMake(0, length), kCFStringEncodingUTF8, 0, false,
+                         reinterpret_cast<UInt8 *>(m_scratch.data()), maxSize, &used);
+        writeString(std::string_view(m_scratch.data(), used));
+    }
+
+    void writeString(std::string_view string) {
+        static constexpr char hex[] = "0123456789abcdef";
+        m_out += '"';
+        size_t runStart = 0;
+        for (size_t i = 0; i < string.size(); ++i) {
+            unsigned char c = string[i];
+            if (c >= 0x20 && c != '"' && c != '\\') {
+                continue;
+            }
+            m_out.append(string.data() + runStart, i - runStart);
+            runStart = i + 1;
+            switch (c) {
+                case '"':  m_out += "\\\""; break;
+                case '\\': m_out += "\\\\"; break;
+                case '\b': m_out += "\\b"; break;
+                case '\f': m_out += "\\f"; break;
+                case '\n': m_out += "\\n"; break;
+                case '\r': m_out += "\\r"; break;
+                case '\t': m_out += "\\t"; break;
+                default:
+                    m_out += "\\u00";
+                    m_out += hex[c >> 4];
+                    m_out += hex[c & 0xf];
+            }
+        }
+        m_out.append(string.data() + runStart, string.size() - runStart);
+        m_out += '"';
+    }
+
+    void writeBinary(const uint8_t *bytes, size_t length, const char *subtype) {
+        static constexpr char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        m_out += "{\"$binary\":{\"base64\":\"";
+        m_out.reserve(m_out.size() + (length + 2) / 3 * 4 + 32);
+        size_t i = 0;
+        for (; i + 2 < length; i += 3) {
+            uint32_t n = (bytes[i] << 16) | (bytes[i + 1] << 8) | bytes[i + 2];
+            m_out += alphabet[(n >> 18) & 63];
+            m_out += alphabet[(n >> 12) & 63];
+            m_out += alphabet[(n >> 6) & 63];
+            m_out += alphabet[n & 63];
+        }
+        if (i < length) {
+            uint32_t n = bytes[i] << 16;
+            if (i + 1 < length) {
+                n |= bytes[i + 1] << 8;
+            }
+            m_out += alphabet[(n >> 18) & 63];
+            m_out += alphabet[(n >> 12) & 63];
+            m_out += i + 1 < length ? alphabet[(n >> 6) & 63] : '=';
+            m_out += '=';
+        }
+        m_out += "\",\"subType\":\"";
+        m_out += subtype;
+        m_out += "\"}}";
+    }
+};
+} // anonymous namespace
+
+std::string RLMConvertRLMBSONToExtendedJSON(id<RLMBSON> value) {
+    std::string out;
+    ExtendedJSONWriter(out).write(value);
+    return out;
+}
+
+NSUInteger RLMAppendExtendedJSONValues(std::string& out, NSArray<id<RLMBSON>> *values, NSUInteger start,
+                                       NSUInteger maxCount, size_t maxBytes) {
+    ExtendedJSONWriter writer(out);
+    size_t initialSize = out.size();
+    NSUInteger count = values.count;
+    NSUInteger end = start >= count ? start : start + std::min(maxCount, count - start);
+    NSUInteger written = 0;
+    for (NSUInteger i = start; i < end; ++i, ++written) {
+        size_t previousSize = out.size();
+        if (written) {
+            out += ',';
+        }
+        writer.write(values[i]);
+        // The value which goes over the limit is removed again unless it's
+        // the only one, as there's no way to know how large a value will be
+        // without encoding it
+        if (written && out.size() - initialSize > maxBytes) {
+            out.resize(previousSize);
+            break;
+        }
+    }
+    return written;
+}
+
 #pragma mark BsonToRLMBSON
 
 id<RLMBSON> RLMConvertBsonToRLMBSON(const Bson& b) {
@@ -421,3 +739,254 @@ NSArray<id<RLMBSON>> *RLMConvertBsonDocumentToRLMBSONArray(std::optional<BsonDoc
     }
     return array;
 }
+
+#pragma mark Lazy documents
+
+namespace {
+// Strings and binary values shorter than this are copied when they're read,
+// as creating an object which refers to the document's storage costs more
+// than copying a small value
+constexpr size_t s_zeroCopyThreshold = 64;
+
+// Documents with at most this many fields are searched linearly rather than
+// building a hash table of their keys
+constexpr size_t s_linearSearchThreshold = 8;
+
+// The core value a lazy document or array was created from. Nested views and
+// zero-copy strings and data all share ownership of the entire received value
+// so that it stays alive for as long as any of them do.
+using BsonOwner = std::shared_ptr<const void>;
+
+id<RLMBSON> RLMLazyBSONValue(const BsonOwner& owner, const Bson& value);
+} // anonymous namespace
+
+@interface RLMBSONDocument ()
+- (instancetype)initWithDocument:(const BsonDocument&)document owner:(BsonOwner)owner;
+@end
+
+@interface RLMBSONArray ()
+- (instancetype)initWithArray:(const BsonArray&)array owner:(BsonOwner)owner;
+@end
+
+@implementation RLMBSONDocument {
+    BsonOwner _owner;
+    const BsonDocument *_document;
+    // The document's fields in order, so that converted values can be cached
+    // by position
+    std::vector<std::pair<std::string_view, const Bson *>> _entries;
+    // Position of each key; only built for larger documents
+    std::unordered_map<std::string_view, size_t> _index;
+    std::vector<id<RLMBSON>> _values;
+    NSArray<NSString *> *_keys;
+    // Guards the lazily-populated members above, as the document may be read
+    // from multiple threads like any other immutable dictionary
+    RLMUnfairMutex _mutex;
+}
+
+- (instancetype)initWithDocument:(const BsonDocument&)document owner:(BsonOwner)owner {
+    if ((self = [super init])) {
+        _owner = std::move(owner);
+        _document = &document;
+        _entries.reserve(document.size());
+        for (const auto& [key, value] : document) {
+            _entries.emplace_back(key, &value);
+        }
+        _values.resize(_entries.size());
+    }
+    return self;
+}
+
+- (NSUInteger)count {
+    return _entries.size();
+}
+
+- (size_t)indexOfKey:(NSString *)key {
+    std::string_view name = key.UTF8String;
+    if (_entries.size() <= s_linearSearchThreshold) {
+        for (size_t i = 0; i < _entries.size(); ++i) {
+            if (_entries[i].first == name) {
+                return i;
+            }
+        }
+        return NSNotFound;
+    }
+
+    std::lock_guard lock(_mutex);
+    if (_index.empty()) {
+        _index.reserve(_entries.size());
+        for (size_t i = 0; i < _entries.size(); ++i) {
+            _index.emplace(_entries[i].first, i);
+        }
+    }
+    auto it = _index.find(name);
+    return it == _index.end() ? NSNotFound : it->second;
+}
+
+- (id<RLMBSON>)valueAtIndex:(size_t)index {
+    std::lock_guard lock(_mutex);
+    id<RLMBSON> value = _values[index];
+    if (!value) {
+        value = _values[index] = RLMLazyBSONValue(_owner, *_entries[index].second);
+    }
+    return value;
+}
+
+- (id)objectForKey:(id)key {
+    if (![key isKindOfClass:[NSString class]]) {
+        return nil;
+    }
+    size_t index = [self indexOfKey:key];
+    return index == NSNotFound ? nil : [self valueAtIndex:index];
+}
+
+- (NSArray *)allKeys {
+    std::lock_guard lock(_mutex);
+    if (!_keys) {
+        NSMutableArray *keys = [[NSMutableArray alloc] initWithCapacity:_entries.size()];
+        for (auto& entry : _entries) {
+            [keys addObject:RLMStringViewToNSString(entry.first)];
+        }
+        _keys = keys;
+    }
+    return _keys;
+}
+
+- (NSEnumerator *)keyEnumerator {
+    return [self.allKeys objectEnumerator];
+}
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state
+                                  objects:(__unsafe_unretained id [])buffer
+                                    count:(NSUInteger)len {
+    return [self.allKeys countByEnumeratingWithState:state objects:buffer count:len];
+}
+
+- (void)enumerateKeysAndObjectsUsingBlock:(void (NS_NOESCAPE ^)(id, id, BOOL *))block {
+    NSArray *keys = self.allKeys;
+    BOOL stop = NO;
+    for (size_t i = 0; i < _entries.size() && !stop; ++i) {
+        block(keys[i], [self valueAtIndex:i], &stop);
+    }
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    return self;
+}
+
+- (BsonDocument)bsonDocumentValue {
+    return *_document;
+}
+
+@end
+
+@implementation RLMBSONArray {
+    BsonOwner _owner;
+    const BsonArray *_array;
+    std::vector<id<RLMBSON>> _values;
+    RLMUnfairMutex _mutex;
+}
+
+- (instancetype)initWithArray:(const BsonArray&)array owner:(BsonOwner)owner {
+    if ((self = [super init])) {
+        _owner = std::move(owner);
+        _array = &array;
+        _values.resize(array.size());
+    }
+    return self;
+}
+
+- (NSUInteger)count {
+    return _values.size();
+}
+
+- (id)objectAtIndex:(NSUInteger)index {
+    if (index >= _values.size()) {
+        @throw [NSException exceptionWithName:NSRangeException
+                                       reason:[NSString stringWithFormat:@"Index %lu is out of bounds (must be less than %lu).",
+                                               (unsigned long)index, (unsigned long)_values.size()]
+                                     userInfo:nil];
+    }
+    std::lock_guard lock(_mutex);
+    id<RLMBSON> value = _values[index];
+    if (!value) {
+        value = _values[index] = RLMLazyBSONValue(_owner, (*_array)[index]);
+    }
+    return value;
+}
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state
+                                  objects:(__unsafe_unretained id [])buffer
+                                    count:(NSUInteger)len {
+    // The converted values are retained by _values, so handing out unretained
+    // pointers to them is safe for as long as the array is alive
+    NSUInteger start = state->state;
+    NSUInteger count = start < _values.size() ? std::min<NSUInteger>(len, _values.size() - start) : 0;
+    for (NSUInteger i = 0; i < count; ++i) {
+        buffer[i] = [self objectAtIndex:start + i];
+    }
+    state->state = start + count;
+    state->itemsPtr = buffer;
+    state->mutationsPtr = state->extra;
+    return count;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    return self;
+}
+
+- (BsonArray)bsonArrayValue {
+    return *_array;
+}
+
+@end
+
+namespace {
+id<RLMBSON> RLMLazyBSONValue(const BsonOwner& owner, const Bson& value) {
+    switch (value.type()) {
+        case realm::bson::Bson::Type::Document:
+            return [[RLMBSONDocument alloc] initWithDocument:static_cast<const BsonDocument&>(value) owner:owner];
+        case realm::bson::Bson::Type::Array:
+            return [[RLMBSONArray alloc] initWithArray:static_cast<const BsonArray&>(value) owner:owner];
+        case realm::bson::Bson::Type::String: {
+            auto& string = static_cast<const std::string&>(value);
+            if (string.size() < s_zeroCopyThreshold) {
+                break;
+            }
+            // The deallocator holds a reference to the owner to keep the
+            // string's storage alive
+            BsonOwner keepAlive = owner;
+            NSString *result = [[NSString alloc] initWithBytesNoCopy:const_cast<char *>(string.data())
+                                                              length:string.size()
+                                                            encoding:NSUTF8StringEncoding
+                                                         deallocator:^(void *, NSUInteger) { (void)keepAlive; }];
+            if (result) {
+                return result;
+            }
+            break;
+        }
+        case realm::bson::Bson::Type::Binary: {
+            auto& binary = static_cast<const std::vector<char>&>(value);
+            if (binary.size() < s_zeroCopyThreshold) {
+                break;
+            }
+            BsonOwner keepAlive = owner;
+            return [[NSData alloc] initWithBytesNoCopy:const_cast<char *>(binary.data())
+                                                length:binary.size()
+                                           deallocator:^(void *, NSUInteger) { (void)keepAlive; }];
+        }
+        default:
+            break;
+    }
+    return RLMConvertBsonToRLMBSON(value);
+}
+} // anonymous namespace
+
+NSDictionary<NSString *, id<RLMBSON>> *RLMMakeLazyBSONDocument(BsonDocument&& document) {
+    auto owner = std::make_shared<const BsonDocument>(std::move(document));
+    return [[RLMBSONDocument alloc] initWithDocument:*owner owner:owner];
+}
+
+NSArray<id<RLMBSON>> *RLMMakeLazyBSONArray(BsonArray&& array) {
+    auto owner = std::make_shared<const BsonArray>(std::move(array));
+    return [[RLMBSONArray alloc] initWithArray:*owner owner:owner];
+}
@@ -19,13 +19,29 @@
 #import <Realm/RLMBSON.h>
 #import <realm/util/optional.hpp>
 
+#import <string>
+
 namespace realm::bson {
 class Bson;
+class BsonArray;
 class BsonDocument;
 }
 
 realm::bson::Bson RLMConvertRLMBSONToBson(id<RLMBSON> b);
 realm::bson::BsonDocument RLMConvertRLMBSONArrayToBsonDocument(NSArray<id<RLMBSON>> *array);
+// Serialize the value to canonical extended JSON without building an
+// intermediate realm::bson::Bson tree
+std::string RLMConvertRLMBSONToExtendedJSON(id<RLMBSON> value);
+// Append comma-separated extended JSON for up to maxCount elements of values
+// beginning at start, stopping before the appended text would exceed maxBytes
+// (but always writing at least one element). Returns the number written.
+NSUInteger RLMAppendExtendedJSONValues(std::string& out, NSArray<id<RLMBSON>> *values, NSUInteger start,
+                                       NSUInteger maxCount, size_t maxBytes);
 id<RLMBSON> RLMConvertBsonToRLMBSON(const realm::bson::Bson& b);
 id<RLMBSON> RLMConvertBsonDocumentToRLMBSON(std::optional<realm::bson::BsonDocument> b);
 NSArray<id<RLMBSON>> *RLMConvertBsonDocumentToRLMBSONArray(std::optional<realm::bson::BsonDocument> b);
+
+// Wrap the given core values in an RLMBSONDocument or RLMBSONArray which
+// converts values to Objective-C objects only when they are read
+NSDictionary<NSString *, id<RLMBSON>> *RLMMakeLazyBSONDocument(realm::bson::BsonDocument&& document);
+NSArray<id<RLMBSON>> *RLMMakeLazyBSONArray(realm::bson::BsonArray&& array);
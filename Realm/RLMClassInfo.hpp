@@ -18,6 +18,7 @@
 
 #import <Realm/RLMConstants.h>
 
+#import <realm/keys.hpp>
 #import <realm/table_ref.hpp>
 #import <realm/util/optional.hpp>
 
@@ -51,6 +52,106 @@ template<> struct equal_to<NSString *> {
 };
 }
 
+// The set of KVO-observed rows for a single table. This stores the head of the
+// RLMObservationInfo linked list for each observed row in a vector so that
+// iterating over all of the observed objects is fast, along with an index from
+// ObjKey to the position in that vector so that finding the observation info
+// for a specific row doesn't require scanning every observed object.
+//
+// An entry for a deleted row may still be present when a new object with the
+// same key is observed. The index always points at the newest entry for a key,
+// and the stale one is still visited when iterating.
+class RLMObservedObjects {
+    using container = std::vector<RLMObservationInfo *>;
+
+public:
+    using const_iterator = container::const_iterator;
+    using const_reverse_iterator = container::const_reverse_iterator;
+
+    // Get the head of the observation info list for the given row, or nullptr
+    // if the row is not observed
+    RLMObservationInfo *_Nullable find(realm::ObjKey key) const noexcept {
+        auto it = m_index.find(key.value);
+        return it == m_index.end() ? nullptr : m_infos[it->second];
+    }
+
+    // Add `info` as the head of the list for the given row
+    void insert(realm::ObjKey key, RLMObservationInfo *info) {
+        m_index[key.value] = m_infos.size();
+        m_infos.push_back(info);
+        m_keys.push_back(key);
+    }
+
+    // Replace the list head `info` for the given row with `next`
+    void replace(realm::ObjKey key, RLMObservationInfo *info, RLMObservationInfo *next) noexcept {
+        size_t pos = position(key, info);
+        if (pos != npos) {
+            m_infos[pos] = next;
+        }
+    }
+
+    // Remove the list head `info` for the given row
+    void erase(realm::ObjKey key, RLMObservationInfo *info) noexcept {
+        size_t pos = position(key, info);
+        if (pos == npos) {
+            return;
+        }
+        auto indexed = m_index.find(key.value);
+        if (indexed != m_index.end() && indexed->second == pos) {
+            m_index.erase(indexed);
+        }
+
+        size_t last = m_infos.size() - 1;
+        if (pos != last) {
+            m_infos[pos] = m_infos[last];
+            m_keys[pos] = m_keys[last];
+            auto moved = m_index.find(m_keys[pos].value);
+            if (moved != m_index.end() && moved->second == last) {
+                moved->second = pos;
+            }
+        }
+        m_infos.pop_back();
+        m_keys.pop_back();
+    }
+
+    void clear() noexcept {
+        m_infos.clear();
+        m_keys.clear();
+        m_index.clear();
+    }
+
+    bool empty() const noexcept { return m_infos.empty(); }
+    size_t size() const noexcept { return m_infos.size(); }
+    RLMObservationInfo *front() const noexcept { return m_infos.front(); }
+
+    const_iterator begin() const noexcept { return m_infos.begin(); }
+    const_iterator end() const noexcept { return m_infos.end(); }
+    const_reverse_iterator rbegin() const noexcept { return m_infos.rbegin(); }
+    const_reverse_iterator rend() const noexcept { return m_infos.rend(); }
+
+private:
+    static constexpr size_t npos = size_t(-1);
+
+    container m_infos;
+    std::vector<realm::ObjKey> m_keys;
+    std::unordered_map<int64_t, size_t> m_index;
+
+    size_t position(realm::ObjKey key, RLMObservationInfo *info) const noexcept {
+        auto it = m_index.find(key.value);
+        if (it != m_index.end() && m_infos[it->second] == info) {
+            return it->second;
+        }
+        // Not the indexed entry for this key, so it must be a stale entry
+        // for a deleted row
+        for (size_t i = 0; i < m_infos.size(); ++i) {
+            if (m_infos[i] == info) {
+                return i;
+            }
+        }
+        return npos;
+    }
+};
+
 // The per-RLMRealm object schema information which stores the cached table
 // reference, handles table column lookups, and tracks observed objects
 class RLMClassInfo {
@@ -66,7 +167,7 @@ public:
 
     // Storage for the functionality in RLMObservation for handling indirect
     // changes to KVO-observed things
-    std::vector<RLMObservationInfo *> observedObjects;
+    RLMObservedObjects observedObjects;
 
     // Get the table for this object type. Will return nullptr only if it's a
     // read-only Realm that is missing the table entirely.
@@ -26,6 +26,7 @@
 #import "RLMObject_Private.hpp"
 #import "RLMObservation.hpp"
 #import "RLMProperty_Private.h"
+#import "RLMQueryUtil.hpp"
 #import "RLMSet_Private.hpp"
 #import "RLMSwiftCollectionBase.h"
 
@@ -34,14 +35,17 @@
 #import <realm/object-store/results.hpp>
 #import <realm/object-store/set.hpp>
 
-static const int RLMEnumerationBufferSize = 16;
+static const NSUInteger RLMEnumerationBufferSize = 16;
 
 @implementation RLMFastEnumerator {
     // The buffer supplied by fast enumeration does not retain the objects given
     // to it, but because we create objects on-demand and don't want them
     // autoreleased (a table can have more rows than the device has memory for
     // accessor objects) we need a thing to retain them.
-    id _strongBuffer[RLMEnumerationBufferSize];
+    std::unique_ptr<id[]> _strongBuffer;
+    // The number of objects produced per call to countByEnumeratingWithState:,
+    // which is also the size of _strongBuffer.
+    NSUInteger _windowSize;
 
     RLMRealm *_realm;
     RLMClassInfo *_info;
@@ -53,6 +57,13 @@ static const int RLMEnumerationBufferSize = 16;
     realm::Results *_results;
     realm::Results _snapshot;
 
+    // The accessor context used for every window of the enumeration, created
+    // lazily on the first window
+    std::optional<RLMAccessorContext> _context;
+    // Scratch space for the objects resolved for the current window when
+    // enumerating a collection of objects
+    std::vector<realm::Obj> _objs;
+
     // A strong reference to the collection being enumerated to ensure it stays
     // alive when we're holding a pointer to a member in it
     id _collection;
@@ -65,6 +76,7 @@ static const int RLMEnumerationBufferSize = 16;
                                  property:(RLMProperty *)property {
     self = [super init];
     if (self) {
+        _windowSize = RLMEnumerationBufferSize;
         _info = info;
         _realm = _info->realm;
         _parentInfo = parentInfo;
@@ -90,6 +102,7 @@ static const int RLMEnumerationBufferSize = 16;
                                  property:(RLMProperty *)property {
     self = [super init];
     if (self) {
+        _windowSize = RLMEnumerationBufferSize;
         _info = info;
         _realm = _info->realm;
         _parentInfo = parentInfo;
@@ -113,6 +126,7 @@ static const int RLMEnumerationBufferSize = 16;
                       classInfo:(RLMClassInfo&)info {
     self = [super init];
     if (self) {
+        _windowSize = RLMEnumerationBufferSize;
         _info = &info;
         _realm = _info->realm;
         if (_realm.inWriteTransaction) {
@@ -140,31 +154,77 @@ static const int RLMEnumerationBufferSize = 16;
     _collection = nil;
 }
 
+- (instancetype)initWithResults:(realm::Results&)results
+                     collection:(id)collection
+                      classInfo:(RLMClassInfo&)info
+                     windowSize:(NSUInteger)windowSize {
+    self = [self initWithResults:results collection:collection classInfo:info];
+    if (self) {
+        _windowSize = windowSize;
+    }
+    return self;
+}
+
+- (RLMAccessorContext&)context {
+    if (!_context) {
+        if (_parentInfo) {
+            _context.emplace(*_parentInfo, *_info, _property);
+        }
+        else {
+            _context.emplace(*_info);
+        }
+    }
+    return *_context;
+}
+
+- (NSUInteger)fillWindowFrom:(NSUInteger)start count:(NSUInteger)count {
+    NSUInteger end = std::min<NSUInteger>(count, start + _windowSize);
+    if (start >= end) {
+        return 0;
+    }
+    auto& ctx = [self context];
+
+    // For collections of objects resolve every Obj in the window before
+    // creating any accessors so that the reads from core are done in a single
+    // pass, and then box them all with the shared context
+    if (_results->get_type() == realm::PropertyType::Object) {
+        _objs.clear();
+        _objs.reserve(end - start);
+        for (NSUInteger index = start; index < end; ++index) {
+            _objs.push_back(_results->get<realm::Obj>(index));
+        }
+        for (NSUInteger i = 0; i < _objs.size(); ++i) {
+            _strongBuffer[i] = ctx.box(std::move(_objs[i]));
+        }
+        _objs.clear();
+        return end - start;
+    }
+
+    for (NSUInteger index = start; index < end; ++index) {
+        _strongBuffer[index - start] = _results->get(ctx, index);
+    }
+    return end - start;
+}
+
 - (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state
-                                    count:(NSUInteger)len {
+                                    count:(__unused NSUInteger)len {
     [_realm verifyThread];
     if (!_results->is_valid()) {
         @throw RLMException(@"Collection is no longer valid");
     }
-    // The fast enumeration buffer size is currently a hardcoded number in the
-    // compiler so this can't actually happen, but just in case it changes in
-    // the future...
-    if (len > RLMEnumerationBufferSize) {
-        len = RLMEnumerationBufferSize;
+    // The objects are returned from our own buffer rather than the one supplied
+    // by the caller, so the number of objects returned per call is bounded by
+    // the window size rather than by `len`.
+    if (!_strongBuffer) {
+        _strongBuffer = std::make_unique<id[]>(_windowSize);
     }
 
-    NSUInteger batchCount = 0, count = state->extra[1];
-
+    NSUInteger batchCount;
     @autoreleasepool {
-        auto ctx = _parentInfo ? RLMAccessorContext(*_parentInfo, *_info, _property) :
-        RLMAccessorContext(*_info);
-        for (NSUInteger index = state->state; index < count && batchCount < len; ++index) {
-            _strongBuffer[batchCount] = _results->get(ctx, index);
-            batchCount++;
-        }
+        batchCount = [self fillWindowFrom:state->state count:state->extra[1]];
     }
 
-    for (NSUInteger i = batchCount; i < len; ++i) {
+    for (NSUInteger i = batchCount; i < _windowSize; ++i) {
         _strongBuffer[i] = nil;
     }
 
@@ -177,9 +237,11 @@ static const int RLMEnumerationBufferSize = 16;
         }
 
         _snapshot = {};
+        _context.reset();
+        _strongBuffer.reset();
     }
 
-    state->itemsPtr = (__unsafe_unretained id *)(void *)_strongBuffer;
+    state->itemsPtr = (__unsafe_unretained id *)(void *)_strongBuffer.get();
     state->state += batchCount;
     state->mutationsPtr = state->extra+1;
 
@@ -326,6 +388,82 @@ template NSArray *RLMCollectionValueForKey(realm::Results&, NSString *, RLMClass
 template NSArray *RLMCollectionValueForKey(realm::List&, NSString *, RLMClassInfo&);
 template NSArray *RLMCollectionValueForKey(realm::object_store::Set&, NSString *, RLMClassInfo&);
 
+RLMProperty *RLMValidatedPackedValuesProperty(RLMObjectSchema *objectSchema, NSString *key,
+                                              bool asDouble, SEL method) {
+    RLMProperty *prop = RLMValidatedProperty(objectSchema, key);
+    bool supported = false;
+    if (!prop.collection) {
+        switch (prop.type) {
+            case RLMPropertyTypeInt:
+                supported = asDouble || !prop.optional;
+                break;
+            case RLMPropertyTypeFloat:
+            case RLMPropertyTypeDouble:
+            case RLMPropertyTypeDate:
+                supported = asDouble;
+                break;
+            default:
+                break;
+        }
+    }
+    if (!supported) {
+        @throw RLMException(@"%@ is not supported for %@%s property '%@.%@'",
+                            NSStringFromSelector(method), RLMTypeToString(prop.type),
+                            prop.optional ? "?" : "", objectSchema.className, prop.name);
+    }
+    return prop;
+}
+
+static double packedDoubleValue(realm::Mixed value) {
+    if (value.is_null()) {
+        return NAN;
+    }
+    switch (value.get_type()) {
+        case realm::type_Int:
+            return static_cast<double>(value.get_int());
+        case realm::type_Float:
+            return value.get_float();
+        case realm::type_Double:
+            return value.get_double();
+        case realm::type_Timestamp: {
+            auto ts = value.get_timestamp();
+            return ts.get_seconds() + ts.get_nanoseconds() / 1'000'000'000.0;
+        }
+        default:
+            REALM_UNREACHABLE();
+    }
+}
+
+template<typename Collection>
+NSData *RLMCollectionPackedValues(Collection& collection, NSString *key, RLMClassInfo& info,
+                                  bool asDouble, SEL method) {
+    if (collection.get_type() != realm::PropertyType::Object) {
+        @throw RLMException(@"%@ is only supported for collections of objects",
+                            NSStringFromSelector(method));
+    }
+    RLMProperty *prop = RLMValidatedPackedValuesProperty(info.rlmObjectSchema, key, asDouble, method);
+    auto column = info.tableColumn(prop);
+
+    size_t count = collection.size();
+    NSMutableData *data = [NSMutableData dataWithLength:count * (asDouble ? sizeof(double) : sizeof(int64_t))];
+    if (asDouble) {
+        auto values = static_cast<double *>(data.mutableBytes);
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = packedDoubleValue(collection.template get<realm::Obj>(i).get_any(column));
+        }
+    }
+    else {
+        auto values = static_cast<int64_t *>(data.mutableBytes);
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = collection.template get<realm::Obj>(i).template get<int64_t>(column);
+        }
+    }
+    return data;
+}
+
+template NSData *RLMCollectionPackedValues(realm::Results&, NSString *, RLMClassInfo&, bool, SEL);
+template NSData *RLMCollectionPackedValues(realm::List&, NSString *, RLMClassInfo&, bool, SEL);
+
 void RLMCollectionSetValueForKey(id<RLMCollectionPrivate> collection, NSString *key, id value) {
     realm::TableView tv = [collection tableView];
     if (tv.size() == 0) {
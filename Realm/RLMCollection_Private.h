@@ -33,6 +33,14 @@ RLMNotificationToken *RLMAddNotificationBlock(id collection, id block,
                                               NSArray<NSString *> *_Nullable keyPaths,
                                               dispatch_queue_t _Nullable queue);
 
+// Sections the collection on the first character of the given string property
+// using RLMSectionKey, so that the section keys are computed without calling
+// back into Swift for each element
+FOUNDATION_EXTERN
+RLMSectionedResults *RLMSectionedResultsByFirstCharacter(id<RLMCollection> collection,
+                                                         NSArray<RLMSortDescriptor *> *sortDescriptors,
+                                                         NSString *property);
+
 typedef RLM_CLOSED_ENUM(int32_t, RLMCollectionType) {
     RLMCollectionTypeArray = 0,
     RLMCollectionTypeSet = 1,
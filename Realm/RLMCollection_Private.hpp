@@ -77,6 +77,13 @@ RLM_DIRECT_MEMBERS
                      collection:(id)collection
                       classInfo:(RLMClassInfo&)info;
 
+// Create an enumerator which produces `windowSize` objects at a time rather
+// than the default of 16.
+- (instancetype)initWithResults:(realm::Results&)results
+                     collection:(id)collection
+                      classInfo:(RLMClassInfo&)info
+                     windowSize:(NSUInteger)windowSize;
+
 // Detach this enumerator from the source collection. Must be called before the
 // source collection is changed.
 - (void)detach;
@@ -101,6 +108,19 @@ realm::CollectionChangeCallback RLMWrapCollectionChangeCallback(void (^block)(id
 template<typename Collection>
 NSArray *RLMCollectionValueForKey(Collection& collection, NSString *key, RLMClassInfo& info);
 
+// Validates that `key` names a property whose values can be packed into a
+// buffer of int64_t (or double, if `asDouble` is set) values. `method` is the
+// public method being called and is used in the exception message.
+RLMProperty *RLMValidatedPackedValuesProperty(RLMObjectSchema *objectSchema, NSString *key,
+                                              bool asDouble, SEL method);
+
+// Reads the given property of each object in the collection directly into a
+// buffer of packed int64_t or double values, without creating accessors or
+// boxed values. Null values are stored as NaN.
+template<typename Collection>
+NSData *RLMCollectionPackedValues(Collection& collection, NSString *key, RLMClassInfo& info,
+                                  bool asDouble, SEL method);
+
 std::vector<std::pair<std::string, bool>> RLMSortDescriptorsToKeypathArray(NSArray<RLMSortDescriptor *> *properties);
 
 realm::ColKey columnForProperty(NSString *propertyName,
@@ -40,6 +40,7 @@
 #import <realm/table_view.hpp>
 
 #import <objc/runtime.h>
+#import <unordered_set>
 
 @interface RLMManagedArrayHandoverMetadata : NSObject
 @property (nonatomic) NSString *parentClassName;
@@ -224,13 +225,24 @@ static void RLMInsertObject(RLMManagedArray *ar, id object, NSUInteger index) {
 }
 
 - (void)insertObjects:(id<NSFastEnumeration>)objects atIndexes:(NSIndexSet *)indexes {
-    changeArray(self, NSKeyValueChangeInsertion, indexes, ^{
-        NSUInteger index = [indexes firstIndex];
+    // Validate everything before modifying the list so that an invalid object
+    // doesn't result in only some of the objects being inserted
+    std::vector<id> values;
+    for (id obj in objects) {
+        RLMArrayValidateMatchingObjectType(self, obj);
+        values.push_back(obj);
+    }
+    if (values.size() != indexes.count) {
+        @throw RLMException(@"Cannot insert %llu objects at %llu indexes.",
+                            (unsigned long long)values.size(), (unsigned long long)indexes.count);
+    }
+    std::vector<NSUInteger> insertionIndexes(values.size());
+    [indexes getIndexes:insertionIndexes.data() maxCount:values.size() inIndexRange:nil];
+
+    changeArray(self, NSKeyValueChangeInsertion, indexes, [&] {
         RLMAccessorContext context(*_ownerInfo, *_objectInfo, _property);
-        for (id obj in objects) {
-            RLMArrayValidateMatchingObjectType(self, obj);
-            _backingList.insert(context, index, obj);
-            index = [indexes indexGreaterThanIndex:index];
+        for (size_t i = 0; i < values.size(); ++i) {
+            _backingList.insert(context, insertionIndexes[i], values[i]);
         }
     });
 }
@@ -250,10 +262,12 @@ static void RLMInsertObject(RLMManagedArray *ar, id object, NSUInteger index) {
 }
 
 - (void)addObjectsFromArray:(NSArray *)array {
+    for (id obj in array) {
+        RLMArrayValidateMatchingObjectType(self, obj);
+    }
     changeArray(self, NSKeyValueChangeInsertion, NSMakeRange(self.count, array.count), ^{
         RLMAccessorContext context(*_ownerInfo, *_objectInfo, _property);
         for (id obj in array) {
-            RLMArrayValidateMatchingObjectType(self, obj);
             _backingList.add(context, obj);
         }
     });
@@ -310,6 +324,109 @@ static void RLMInsertObject(RLMManagedArray *ar, id object, NSUInteger index) {
     });
 }
 
+- (void)replaceObjectsInRange:(NSRange)range withObjects:(NSArray *)objects {
+    for (id obj in objects) {
+        RLMArrayValidateMatchingObjectType(self, obj);
+    }
+    RLMArrayValidateRange(range, self.count);
+    if (!range.length && !objects.count) {
+        return;
+    }
+
+    NSUInteger count = objects.count;
+    auto replace = [&] {
+        RLMAccessorContext context(*_ownerInfo, *_objectInfo, _property);
+        NSUInteger overlap = std::min<NSUInteger>(range.length, count);
+        for (NSUInteger i = 0; i < overlap; ++i) {
+            _backingList.set(context, range.location + i, objects[i]);
+        }
+        for (NSUInteger i = overlap; i < count; ++i) {
+            _backingList.insert(context, range.location + i, objects[i]);
+        }
+        for (NSUInteger i = range.length; i > overlap; --i) {
+            _backingList.remove(range.location + i - 1);
+        }
+    };
+
+    // KVO can't describe a change which both replaces and inserts or removes
+    // values, so report those as the whole list being set
+    if (range.length == count) {
+        changeArray(self, NSKeyValueChangeReplacement, range, replace);
+    }
+    else {
+        changeArray(self, NSKeyValueChangeSetting, replace, [] { return (NSIndexSet *)nil; });
+    }
+}
+
+- (void)reorderObjectsWithIndexes:(NSArray<NSNumber *> *)indexes {
+    auto permutation = RLMArrayValidatePermutation(indexes, self.count);
+    NSMutableIndexSet *changed = [NSMutableIndexSet new];
+    for (size_t i = 0; i < permutation.size(); ++i) {
+        if (permutation[i] != i) {
+            [changed addIndex:i];
+        }
+    }
+    if (!changed.count) {
+        return;
+    }
+
+    changeArray(self, NSKeyValueChangeReplacement, changed, [&] {
+        // Apply the permutation one cycle at a time, which takes one swap for
+        // each element which moves other than the last in each cycle
+        std::vector<bool> placed(permutation.size());
+        for (size_t start = 0; start < permutation.size(); ++start) {
+            if (placed[start]) {
+                continue;
+            }
+            placed[start] = true;
+            for (size_t i = start; permutation[i] != start; i = permutation[i]) {
+                _backingList.swap(i, permutation[i]);
+                placed[permutation[i]] = true;
+            }
+        }
+    });
+}
+
+- (void)removeObjectsWithPredicate:(NSPredicate *)predicate {
+    if (_property->_type != RLMPropertyTypeObject) {
+        @throw RLMException(@"Querying is currently only implemented for arrays of Realm Objects");
+    }
+    auto query = RLMPredicateToQuery(predicate, _objectInfo->rlmObjectSchema, _realm.schema, _realm.group);
+
+    // Evaluate the query once over the list, then find the positions of the
+    // matching objects in a single scan. Objects can appear in a list more
+    // than once, so this can't just use the indexes of the matches.
+    auto indexes = translateErrors([&] {
+        auto matches = _backingList.filter(std::move(query));
+        std::unordered_set<realm::ObjKey> matchingKeys;
+        for (size_t i = 0, count = matches.size(); i < count; ++i) {
+            matchingKeys.insert(matches.get(i).get_key());
+        }
+        std::vector<size_t> indexes;
+        for (size_t i = 0, count = _backingList.size(); i < count; ++i) {
+            if (matchingKeys.count(_backingList.get(i).get_key())) {
+                indexes.push_back(i);
+            }
+        }
+        return indexes;
+    });
+    if (indexes.empty()) {
+        return;
+    }
+
+    changeArray(self, NSKeyValueChangeRemoval, [&] {
+        for (auto it = indexes.rbegin(); it != indexes.rend(); ++it) {
+            _backingList.remove(*it);
+        }
+    }, [&] {
+        NSMutableIndexSet *set = [NSMutableIndexSet new];
+        for (size_t index : indexes) {
+            [set addIndex:index];
+        }
+        return set;
+    });
+}
+
 - (NSUInteger)indexOfObject:(id)object {
     RLMArrayValidateMatchingObjectType(self, object);
     return translateErrors([&] {
@@ -390,6 +507,18 @@ static void RLMInsertObject(RLMManagedArray *ar, id object, NSUInteger index) {
     return value ? RLMMixedToObjc(*value) : nil;
 }
 
+- (NSData *)int64ValuesOfProperty:(NSString *)property {
+    return translateErrors([&] {
+        return RLMCollectionPackedValues(_backingList, property, *_objectInfo, false, _cmd);
+    });
+}
+
+- (NSData *)doubleValuesOfProperty:(NSString *)property {
+    return translateErrors([&] {
+        return RLMCollectionPackedValues(_backingList, property, *_objectInfo, true, _cmd);
+    });
+}
+
 - (void)deleteObjectsFromRealm {
     auto type = _property->_type;
     if (type != RLMPropertyTypeObject) {
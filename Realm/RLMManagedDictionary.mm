@@ -296,17 +296,43 @@ static NSMutableArray *resultsToArray(RLMClassInfo& info, realm::Results r) {
     });
 }
 
+// Box a value produced by iterating the dictionary, which is the stored value
+// rather than what get() would produce for the key
+static id boxIteratedValue(RLMManagedDictionary *self, RLMAccessorContext& context,
+                           realm::Mixed const& key, realm::Mixed const& value) {
+    if (value.is_type(realm::type_Dictionary)) {
+        return context.box(self->_backingCollection.get_dictionary(realm::PathElement{key.get_string()}));
+    }
+    if (value.is_type(realm::type_List)) {
+        return context.box(self->_backingCollection.get_list(realm::PathElement{key.get_string()}));
+    }
+    if (self->_property.type == RLMPropertyTypeObject && value.is_type(realm::type_TypedLink)) {
+        // Links in object dictionaries are all to the same table, so they can
+        // be created from the known class info rather than looking it up
+        return context.box(realm::Mixed(value.get<realm::ObjLink>().get_obj_key()));
+    }
+    return context.box(value);
+}
+
+// Enumeration drains the autorelease pool after this many entries so that
+// enumerating a large dictionary doesn't keep every boxed value alive
+static constexpr size_t s_enumerationBatchSize = 1024;
+
 - (void)enumerateKeysAndObjectsUsingBlock:(void (^)(id key, id obj, BOOL *stop))block {
-    RLMAccessorContext context(*_ownerInfo, *_objectInfo, _property);
-    BOOL stop = false;
-    @autoreleasepool {
-        for (auto&& [key, value] : _backingCollection) {
-            block(context.box(key), _backingCollection.get(context, key.get_string()), &stop);
-            if (stop) {
-                break;
+    translateErrors([&] {
+        RLMAccessorContext context(*_ownerInfo, *_objectInfo, _property);
+        BOOL stop = false;
+        auto it = _backingCollection.begin();
+        auto end = _backingCollection.end();
+        while (!stop && it != end) {
+            @autoreleasepool {
+                for (size_t i = 0; !stop && i < s_enumerationBatchSize && it != end; ++i, ++it) {
+                    auto&& [key, value] = *it;
+                    block(context.box(key), boxIteratedValue(self, context, key, value), &stop);
+                }
             }
         }
-    }
+    });
 }
 
 - (void)mergeDictionary:(id)dictionary clear:(bool)clear {
@@ -21,7 +21,7 @@
 RLM_HEADER_AUDIT_BEGIN(nullability, sendability)
 @protocol RLMBSON;
 
-@class RLMFindOptions, RLMFindOneAndModifyOptions, RLMUpdateResult, RLMChangeStream, RLMObjectId;
+@class RLMFindOptions, RLMFindOneAndModifyOptions, RLMUpdateResult, RLMChangeStream, RLMChangeStreamBatchOptions, RLMInsertManyOptions, RLMObjectId;
 
 /// Delegate which is used for subscribing to changes on a `[RLMMongoCollection watch]` stream.
 @protocol RLMChangeEventDelegate
@@ -39,6 +39,62 @@ RLM_HEADER_AUDIT_BEGIN(nullability, sendability)
 - (void)changeStreamDidReceiveChangeEvent:(id<RLMBSON>)changeEvent;
 @end
 
+/// Delegate which is used for subscribing to changes on a batched
+/// `[RLMMongoCollection watch]` stream, which delivers change events in groups
+/// rather than individually.
+@protocol RLMChangeEventBatchDelegate
+/// The stream was opened.
+/// @param changeStream The RLMChangeStream subscribing to the stream changes.
+- (void)changeStreamDidOpen:(RLMChangeStream *)changeStream;
+/// The stream has been closed.
+/// @param error If an error occured when closing the stream, an error will be passed.
+- (void)changeStreamDidCloseWithError:(nullable NSError *)error;
+/// A error has occured while streaming.
+/// @param error The streaming error.
+- (void)changeStreamDidReceiveError:(NSError *)error;
+/// Invoked when one or more change events have been received.
+/// @param changeEvents The change events in BSON format, in the order they were received.
+- (void)changeStreamDidReceiveChangeEvents:(NSArray<id<RLMBSON>> *)changeEvents;
+@end
+
+/// Options controlling how a batched change stream groups change events.
+@interface RLMChangeStreamBatchOptions : NSObject <NSCopying>
+
+/// The maximum number of change events delivered in a single callback.
+/// Specifying 0 (the default) places no limit on the size of a batch.
+@property (nonatomic) NSUInteger maximumBatchSize;
+
+/// How long to wait for further change events before delivering a batch, in
+/// seconds. With the default of 0, all of the change events decoded from each
+/// chunk of data received from the server are delivered together as soon as
+/// they have been decoded.
+@property (nonatomic) NSTimeInterval maximumLatency;
+
+/// The maximum number of change events which may have been received but not
+/// yet delivered to the delegate. When this many are waiting, reading from the
+/// server is paused until the delegate has caught up. Specifying 0 (the
+/// default) allows an unbounded number of events to wait.
+@property (nonatomic) NSUInteger maximumBufferedEvents;
+
+@end
+
+/// Options controlling how `-[RLMMongoCollection insertManyDocuments:options:progress:completion:]`
+/// splits the documents into multiple requests.
+@interface RLMInsertManyOptions : NSObject <NSCopying>
+
+/// The maximum number of documents sent in a single request. Defaults to 1000.
+@property (nonatomic) NSUInteger maximumDocumentsPerRequest;
+
+/// The maximum size in bytes of the documents sent in a single request, as
+/// encoded for sending to the server. A document which is larger than this on
+/// its own is sent in a request by itself. Defaults to 4 MB.
+@property (nonatomic) NSUInteger maximumBytesPerRequest;
+
+/// The maximum number of requests which may be in progress at once. Defaults to 4.
+@property (nonatomic) NSUInteger maximumConcurrentRequests;
+
+@end
+
 /// Acts as a middleman and processes events with WatchStream
 RLM_SWIFT_SENDABLE RLM_FINAL // is internally thread-safe
 @interface RLMChangeStream : NSObject<RLMEventDelegate>
@@ -74,6 +130,10 @@ typedef void(^RLMMongoInsertBlock)(id<RLMBSON> _Nullable, NSError * _Nullable);
 /// Block which returns an array of object ids on a successful insertMany, or an error should one occur.
 RLM_SWIFT_SENDABLE // invoked on a background thread
 typedef void(^RLMMongoInsertManyBlock)(NSArray<id<RLMBSON>> * _Nullable, NSError * _Nullable);
+/// Block which is called with the number of documents which have been inserted so far by a
+/// chunked insertMany, and the total number of documents being inserted.
+RLM_SWIFT_SENDABLE // invoked on a background thread
+typedef void(^RLMMongoInsertProgressBlock)(NSUInteger insertedCount, NSUInteger totalCount);
 /// Block which returns an array of Documents on a successful find operation, or an error should one occur.
 RLM_SWIFT_SENDABLE // invoked on a background thread
 typedef void(^RLMMongoFindBlock)(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> * _Nullable,
@@ -110,6 +170,24 @@ typedef void(^RLMMongoDeleteBlock)(NSDictionary<NSString *, id<RLMBSON>> * _Null
 - (void)insertManyDocuments:(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)documents
                  completion:(RLMMongoInsertManyBlock)completion NS_REFINED_FOR_SWIFT;
 
+/// Encodes the provided values to BSON and inserts them, splitting them into
+/// multiple requests which are sent concurrently. If any values are missing
+/// identifiers, they will be generated.
+///
+/// Each request is only encoded once there is room for it to be sent, so
+/// sending begins before all of the documents have been encoded. If a request
+/// fails no further requests are sent and the completion is called with the
+/// error, but the documents in requests which had already been sent may have
+/// been inserted.
+/// @param documents  The `Document` values in a bson array to insert.
+/// @param options Options controlling how the documents are split into requests.
+/// @param progress An optional block which is called each time a request completes.
+/// @param completion The result of the insert, returns an array inserted document ids in order
+- (void)insertManyDocuments:(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)documents
+                    options:(RLMInsertManyOptions *)options
+                   progress:(nullable RLMMongoInsertProgressBlock)progress
+                 completion:(RLMMongoInsertManyBlock)completion NS_REFINED_FOR_SWIFT;
+
 /// Finds the documents in this collection which match the provided filter.
 /// @param filterDocument A `Document` as bson that should match the query.
 /// @param options `RLMFindOptions` to use when executing the command.
@@ -325,6 +403,23 @@ typedef void(^RLMMongoDeleteBlock)(NSDictionary<NSString *, id<RLMBSON>> * _Null
                                  delegate:(id<RLMChangeEventDelegate>)delegate
                             delegateQueue:(nullable dispatch_queue_t)queue NS_REFINED_FOR_SWIFT;
 
+/// Opens a MongoDB change stream against the collection to watch for changes,
+/// delivering the change events to the delegate in batches. Compared to the
+/// unbatched methods, this avoids a dispatch to the delegate queue and a
+/// delegate call for every change event when many changes arrive at once.
+/// @param matchFilter An optional $match filter to apply to incoming change events.
+/// @param filterIds An optional list of the _ids of the documents to watch.
+/// @param options Options controlling how change events are grouped. If `nil`,
+///                the events decoded from each chunk of data received from the
+///                server are delivered together.
+/// @param delegate The delegate that will react to events and errors from the resulting change stream.
+/// @param queue Dispatches streaming events to an optional queue, if no queue is provided the main queue is used
+- (RLMChangeStream *)watchWithMatchFilter:(nullable NSDictionary<NSString *, id<RLMBSON>> *)matchFilter
+                                filterIds:(nullable NSArray<RLMObjectId *> *)filterIds
+                             batchOptions:(nullable RLMChangeStreamBatchOptions *)options
+                                 delegate:(id<RLMChangeEventBatchDelegate>)delegate
+                            delegateQueue:(nullable dispatch_queue_t)queue NS_REFINED_FOR_SWIFT;
+
 @end
 
 RLM_HEADER_AUDIT_END(nullability, sendability)
@@ -26,19 +26,50 @@
 #import "RLMNetworkTransport_Private.hpp"
 #import "RLMUpdateResult_Private.hpp"
 #import "RLMUser_Private.hpp"
+#import "RLMUtil.hpp"
 
 #import <realm/object-store/sync/app_user.hpp>
 #import <realm/object-store/sync/mongo_client.hpp>
 #import <realm/object-store/sync/mongo_collection.hpp>
 #import <realm/object-store/sync/mongo_database.hpp>
 
+#import <condition_variable>
+#import <deque>
+#import <mutex>
+
+@implementation RLMChangeStreamBatchOptions
+- (id)copyWithZone:(NSZone *)zone {
+    RLMChangeStreamBatchOptions *options = [[RLMChangeStreamBatchOptions allocWithZone:zone] init];
+    options.maximumBatchSize = _maximumBatchSize;
+    options.maximumLatency = _maximumLatency;
+    options.maximumBufferedEvents = _maximumBufferedEvents;
+    return options;
+}
+@end
+
 __attribute__((objc_direct_members))
 @implementation RLMChangeStream {
 @public
     realm::app::WatchStream _watchStream;
-    id<RLMChangeEventDelegate> _subscriber;
+    // Either an id<RLMChangeEventDelegate> or, if _batchOptions is set, an
+    // id<RLMChangeEventBatchDelegate>
+    id _subscriber;
     __weak NSURLSession *_session;
     void (^_schedule)(dispatch_block_t);
+
+    // State for batched streams. Events are decoded on the URL session's
+    // delegate queue, while batches may also be flushed by a timer and
+    // delivered events are counted on the delegate queue.
+    RLMChangeStreamBatchOptions *_batchOptions;
+    std::mutex _batchMutex;
+    std::condition_variable _batchDelivered;
+    // Events which have been decoded but not yet scheduled for delivery
+    NSMutableArray<id<RLMBSON>> *_pendingEvents;
+    // Events which have been decoded but not yet delivered to the delegate,
+    // including those which are pending
+    NSUInteger _undeliveredEvents;
+    bool _flushScheduled;
+    bool _closed;
 }
 
 - (instancetype)initWithChangeEventSubscriber:(id<RLMChangeEventDelegate>)subscriber
@@ -50,7 +81,20 @@ __attribute__((objc_direct_members))
     return self;
 }
 
+- (instancetype)initWithBatchSubscriber:(id<RLMChangeEventBatchDelegate>)subscriber
+                                options:(RLMChangeStreamBatchOptions *)options
+                              scheduler:(void (^)(dispatch_block_t))scheduler {
+    if (self = [super init]) {
+        _subscriber = subscriber;
+        _schedule = scheduler;
+        _batchOptions = [options copy];
+        _pendingEvents = [NSMutableArray new];
+    }
+    return self;
+}
+
 - (void)didCloseWithError:(NSError *)error {
+    [self flushPendingEvents];
     _schedule(^{
         [_subscriber changeStreamDidCloseWithError:error];
     });
@@ -63,6 +107,7 @@ __attribute__((objc_direct_members))
 }
 
 - (void)didReceiveError:(nonnull NSError *)error {
+    [self flushPendingEvents];
     _schedule(^{
         [_subscriber changeStreamDidReceiveError:error];
     });
@@ -75,6 +120,16 @@ __attribute__((objc_direct_members))
         }];
     }
 
+    if (_batchOptions) {
+        NSMutableArray<id<RLMBSON>> *events = [NSMutableArray new];
+        while (_watchStream.state() == realm::app::WatchStream::State::HAVE_EVENT) {
+            [events addObject:RLMConvertBsonToRLMBSON(_watchStream.next_event())];
+        }
+        if (events.count) {
+            [self enqueueEvents:events];
+        }
+    }
+
     while (_watchStream.state() == realm::app::WatchStream::State::HAVE_EVENT) {
         id<RLMBSON> event = RLMConvertBsonToRLMBSON(_watchStream.next_event());
         _schedule(^{
@@ -87,11 +142,73 @@ __attribute__((objc_direct_members))
     }
 }
 
+- (void)enqueueEvents:(NSArray<id<RLMBSON>> *)events {
+    std::unique_lock lock(_batchMutex);
+    if (NSUInteger limit = _batchOptions.maximumBufferedEvents) {
+        // Blocking the URL session's delegate queue stops it from reading
+        // from the connection, which pushes back on the server until the
+        // delegate has caught up
+        _batchDelivered.wait(lock, [&] { return _closed || _undeliveredEvents < limit; });
+    }
+    if (_closed) {
+        return;
+    }
+    _undeliveredEvents += events.count;
+    [_pendingEvents addObjectsFromArray:events];
+
+    NSUInteger batchSize = _batchOptions.maximumBatchSize;
+    NSTimeInterval latency = _batchOptions.maximumLatency;
+    if (latency <= 0 || (batchSize && _pendingEvents.count >= batchSize)) {
+        [self schedulePendingEvents];
+    }
+    else if (!_flushScheduled) {
+        _flushScheduled = true;
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(latency * NSEC_PER_SEC)),
+                       dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+            std::lock_guard lock(_batchMutex);
+            _flushScheduled = false;
+            [self schedulePendingEvents];
+        });
+    }
+}
+
+- (void)flushPendingEvents {
+    if (_batchOptions) {
+        std::lock_guard lock(_batchMutex);
+        [self schedulePendingEvents];
+    }
+}
+
+// Must be called with _batchMutex held. Batches are scheduled while holding
+// the lock so that they're delivered in the order they were received.
+- (void)schedulePendingEvents {
+    NSUInteger count = _pendingEvents.count;
+    if (!count) {
+        return;
+    }
+    NSUInteger batchSize = _batchOptions.maximumBatchSize ?: count;
+    for (NSUInteger start = 0; start < count; start += batchSize) {
+        NSArray<id<RLMBSON>> *batch = [_pendingEvents subarrayWithRange:NSMakeRange(start, std::min(batchSize, count - start))];
+        _schedule(^{
+            [_subscriber changeStreamDidReceiveChangeEvents:batch];
+            std::lock_guard lock(_batchMutex);
+            _undeliveredEvents -= batch.count;
+            _batchDelivered.notify_all();
+        });
+    }
+    [_pendingEvents removeAllObjects];
+}
+
 - (void)attachURLSession:(NSURLSession *)urlSession {
     _session = urlSession;
 }
 
 - (void)close {
+    if (_batchOptions) {
+        std::lock_guard lock(_batchMutex);
+        _closed = true;
+        _batchDelivered.notify_all();
+    }
     [_session invalidateAndCancel];
 }
 @end
@@ -103,11 +220,227 @@ static realm::bson::BsonArray toBsonArray(id<RLMBSON> bson) {
     return realm::bson::BsonArray(RLMConvertRLMBSONToBson(bson));
 }
 
+static void reportInsertedIds(std::string_view response, RLMMongoInsertManyBlock completion) {
+    NSArray<id<RLMBSON>> *insertedIds;
+    try {
+        auto result = realm::bson::parse(response);
+        if (result.type() != realm::bson::Bson::Type::Document) {
+            throw std::runtime_error("insertMany returned an unexpected response: " + std::string(response));
+        }
+        auto& ids = static_cast<const realm::bson::BsonDocument&>(result).at("insertedIds");
+        if (ids.type() != realm::bson::Bson::Type::Array) {
+            throw std::runtime_error("insertMany returned an unexpected response: " + std::string(response));
+        }
+        insertedIds = (NSArray *)RLMConvertBsonToRLMBSON(ids);
+    }
+    catch (std::exception const& e) {
+        return completion(nil, makeError(e));
+    }
+    completion(insertedIds, nil);
+}
+
 __attribute__((objc_direct_members))
 @interface RLMMongoCollection ()
 @property (nonatomic, strong) RLMUser *user;
 @property (nonatomic, strong) NSString *serviceName;
 @property (nonatomic, strong) NSString *databaseName;
+
+- (std::string)insertManyArgumentsPrefix;
+- (void)insertManyWithArguments:(std::string&&)args
+                 functionCaller:(nullable RLMMongoFunctionCaller)functionCaller
+                     completion:(RLMMongoInsertManyBlock)completion;
+@end
+
+@implementation RLMInsertManyOptions
+- (instancetype)init {
+    if (self = [super init]) {
+        _maximumDocumentsPerRequest = 1000;
+        _maximumBytesPerRequest = 4 * 1024 * 1024;
+        _maximumConcurrentRequests = 4;
+    }
+    return self;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    RLMInsertManyOptions *options = [[RLMInsertManyOptions allocWithZone:zone] init];
+    options.maximumDocumentsPerRequest = _maximumDocumentsPerRequest;
+    options.maximumBytesPerRequest = _maximumBytesPerRequest;
+    options.maximumConcurrentRequests = _maximumConcurrentRequests;
+    return options;
+}
+@end
+
+// Performs a chunked insertMany. Each request's arguments are only encoded
+// once there's room for another request to be in flight, and the operation
+// keeps itself alive via the request completion blocks until all of them
+// have completed.
+@interface RLMInsertManyOperation : NSObject
+@end
+
+@implementation RLMInsertManyOperation {
+    RLMMongoCollection *_collection;
+    NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *_documents;
+    RLMInsertManyOptions *_options;
+    RLMMongoInsertProgressBlock _progress;
+    RLMMongoFunctionCaller _functionCaller;
+    RLMMongoInsertManyBlock _completion;
+    std::string _argumentsPrefix;
+
+    std::mutex _mutex;
+    NSUInteger _nextDocument;
+    NSUInteger _requestsInFlight;
+    NSUInteger _insertedCount;
+    // The ids returned by each request, in the order the requests were made
+    std::vector<NSArray<id<RLMBSON>> *> _insertedIds;
+    NSError *_error;
+    // Set while a thread is in the loop in -sendRequests. Other calls return
+    // immediately and leave sending to that loop, so that requests which
+    // complete synchronously don't recurse.
+    bool _sending;
+    // Inserted counts which haven't yet been passed to the progress block, in
+    // the order they were reached. They're delivered by one thread at a time
+    // without holding the lock, which keeps them in order.
+    std::deque<NSUInteger> _pendingProgress;
+    bool _deliveringProgress;
+    // Set when the last request completes, and cleared when the completion
+    // block is scheduled to be called after the pending progress
+    bool _finished;
+}
+
+- (instancetype)initWithCollection:(RLMMongoCollection *)collection
+                         documents:(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)documents
+                           options:(RLMInsertManyOptions *)options
+                          progress:(RLMMongoInsertProgressBlock)progress
+                    functionCaller:(RLMMongoFunctionCaller)functionCaller
+                        completion:(RLMMongoInsertManyBlock)completion {
+    if (self = [super init]) {
+        _collection = collection;
+        _documents = [documents copy];
+        _options = [options copy];
+        _progress = progress;
+        _functionCaller = functionCaller;
+        _completion = completion;
+        _argumentsPrefix = [collection insertManyArgumentsPrefix];
+    }
+    return self;
+}
+
+- (void)start {
+    if (_documents.count == 0) {
+        return _completion(@[], nil);
+    }
+    [self sendRequests];
+}
+
+- (void)sendRequests {
+    {
+        std::lock_guard lock(_mutex);
+        if (_sending) {
+            return;
+        }
+        _sending = true;
+    }
+
+    // Requests are sent after releasing the lock as the completion may be
+    // called synchronously, in which case it frees up room for the next
+    // iteration of this loop to send another request
+    while (true) {
+        std::vector<std::pair<size_t, std::string>> requests;
+        {
+            std::lock_guard lock(_mutex);
+            while (!_error && _nextDocument < _documents.count
+                   && _requestsInFlight < _options.maximumConcurrentRequests) {
+                std::string args = _argumentsPrefix;
+                _nextDocument += RLMAppendExtendedJSONValues(args, _documents, _nextDocument,
+                                                             _options.maximumDocumentsPerRequest,
+                                                             _options.maximumBytesPerRequest);
+                args += "]}]";
+                ++_requestsInFlight;
+                requests.emplace_back(_insertedIds.size(), std::move(args));
+                _insertedIds.push_back(nil);
+            }
+            if (requests.empty()) {
+                _sending = false;
+                return;
+            }
+        }
+        for (auto& request : requests) {
+            size_t index = request.first;
+            [_collection insertManyWithArguments:std::move(request.second)
+                                  functionCaller:_functionCaller
+                                      completion:^(NSArray<id<RLMBSON>> *insertedIds, NSError *error) {
+                [self requestAtIndex:index completedWithIds:insertedIds error:error];
+            }];
+        }
+    }
+}
+
+- (void)requestAtIndex:(size_t)index completedWithIds:(NSArray<id<RLMBSON>> *)insertedIds error:(NSError *)error {
+    bool finished;
+    {
+        std::lock_guard lock(_mutex);
+        --_requestsInFlight;
+        if (error) {
+            _error = _error ?: error;
+        }
+        else {
+            _insertedIds[index] = insertedIds;
+            _insertedCount += insertedIds.count;
+            if (_progress && !_error) {
+                _pendingProgress.push_back(_insertedCount);
+            }
+        }
+        finished = _requestsInFlight == 0 && (_error || _nextDocument == _documents.count);
+        _finished = _finished || finished;
+    }
+
+    [self deliverProgress];
+    if (!finished) {
+        [self sendRequests];
+    }
+}
+
+// Deliver any pending progress notifications, followed by the completion once
+// all requests have finished. The user blocks are called without holding the
+// lock so that they can't deadlock against the operation.
+- (void)deliverProgress {
+    {
+        std::lock_guard lock(_mutex);
+        if (_deliveringProgress) {
+            return;
+        }
+        _deliveringProgress = true;
+    }
+
+    bool complete = false;
+    while (true) {
+        NSUInteger insertedCount;
+        {
+            std::lock_guard lock(_mutex);
+            if (_pendingProgress.empty()) {
+                _deliveringProgress = false;
+                complete = _finished;
+                _finished = false;
+                break;
+            }
+            insertedCount = _pendingProgress.front();
+            _pendingProgress.pop_front();
+        }
+        _progress(insertedCount, _documents.count);
+    }
+
+    if (!complete) {
+        return;
+    }
+    if (_error) {
+        return _completion(nil, _error);
+    }
+    NSMutableArray<id<RLMBSON>> *allIds = [[NSMutableArray alloc] initWithCapacity:_insertedCount];
+    for (NSArray<id<RLMBSON>> *ids : _insertedIds) {
+        [allIds addObjectsFromArray:ids];
+    }
+    _completion(allIds, nil);
+}
 @end
 
 __attribute__((objc_direct_members))
@@ -143,7 +476,7 @@ __attribute__((objc_direct_members))
         if (error) {
             return completion(nil, makeError(*error));
         }
-        completion((NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)RLMConvertBsonToRLMBSON(*documents), nil);
+        completion((NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)RLMMakeLazyBSONArray(std::move(*documents)), nil);
     });
 }
 
@@ -162,7 +495,7 @@ __attribute__((objc_direct_members))
             return completion(nil, makeError(*error));
         }
         if (document) {
-            completion((NSDictionary<NSString *, id<RLMBSON>> *)RLMConvertBsonToRLMBSON(*document), nil);
+            completion(RLMMakeLazyBSONDocument(std::move(*document)), nil);
         } else {
             completion(nil, nil);
         }
@@ -188,17 +521,72 @@ __attribute__((objc_direct_members))
 
 - (void)insertManyDocuments:(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)documents
                  completion:(RLMMongoInsertManyBlock)completion {
-    self.collection.insert_many(toBsonArray(documents),
-                                [completion](realm::bson::BsonArray insertedIds,
-                                             std::optional<realm::app::AppError> error) {
+    // Rather than going through MongoCollection::insert_many(), which would
+    // require converting the documents to Bson only for core to then
+    // serialize them, write the function arguments directly as extended JSON
+    std::string args = [self insertManyArgumentsPrefix];
+    RLMAppendExtendedJSONValues(args, documents, 0, NSUIntegerMax, SIZE_MAX);
+    args += "]}]";
+    [self insertManyWithArguments:std::move(args) functionCaller:nil completion:completion];
+}
+
+- (void)insertManyDocuments:(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)documents
+                    options:(RLMInsertManyOptions *)options
+                   progress:(RLMMongoInsertProgressBlock)progress
+                 completion:(RLMMongoInsertManyBlock)completion {
+    [self insertManyDocuments:documents options:options progress:progress functionCaller:nil completion:completion];
+}
+
+- (void)insertManyDocuments:(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)documents
+                    options:(RLMInsertManyOptions *)options
+                   progress:(RLMMongoInsertProgressBlock)progress
+             functionCaller:(RLMMongoFunctionCaller)functionCaller
+                 completion:(RLMMongoInsertManyBlock)completion {
+    if (!options.maximumDocumentsPerRequest || !options.maximumBytesPerRequest || !options.maximumConcurrentRequests) {
+        @throw RLMException(@"Invalid insert options: the maximum documents per request, bytes per request and concurrent requests must all be greater than zero.");
+    }
+    [[[RLMInsertManyOperation alloc] initWithCollection:self
+                                              documents:documents
+                                                options:options
+                                               progress:progress
+                                         functionCaller:functionCaller
+                                             completion:completion] start];
+}
+
+// The arguments for an insertMany call up to the start of the documents array
+- (std::string)insertManyArgumentsPrefix {
+    std::string args = RLMConvertRLMBSONToExtendedJSON(@{
+        @"database": self.databaseName,
+        @"collection": self.name,
+    });
+    args.pop_back();
+    args = "[" + args + ",\"documents\":[";
+    return args;
+}
+
+- (void)insertManyWithArguments:(std::string&&)args
+                 functionCaller:(RLMMongoFunctionCaller)functionCaller
+                     completion:(RLMMongoInsertManyBlock)completion {
+    if (functionCaller) {
+        NSString *arguments = [[NSString alloc] initWithBytes:args.data() length:args.size()
+                                                     encoding:NSUTF8StringEncoding];
+        functionCaller(@"insertMany", arguments, ^(NSString *response, NSError *error) {
+            if (error) {
+                return completion(nil, error);
+            }
+            reportInsertedIds(response.UTF8String ?: "", completion);
+        });
+        return;
+    }
+
+    auto user = _user.user;
+    user->app()->call_function(user, "insertMany", args, std::string(self.serviceName.UTF8String),
+                               [completion](const std::string *response,
+                                            std::optional<realm::app::AppError> error) {
         if (error) {
             return completion(nil, makeError(*error));
         }
-        NSMutableArray *insertedArr = [[NSMutableArray alloc] initWithCapacity:insertedIds.size()];
-        for (auto& objectId : insertedIds) {
-            [insertedArr addObject:RLMConvertBsonToRLMBSON(objectId)];
-        }
-        completion(insertedArr, nil);
+        reportInsertedIds(*response, completion);
     });
 }
 
@@ -210,7 +598,7 @@ __attribute__((objc_direct_members))
         if (error) {
             return completion(nil, makeError(*error));
         }
-        completion((NSArray<id> *)RLMConvertBsonToRLMBSON(*documents), nil);
+        completion((NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)RLMMakeLazyBSONArray(std::move(*documents)), nil);
     });
 }
 
@@ -320,7 +708,7 @@ __attribute__((objc_direct_members))
             return completion(nil, makeError(*error));
         }
 
-        return completion((NSDictionary *)RLMConvertBsonDocumentToRLMBSON(document), nil);
+        return completion(document ? RLMMakeLazyBSONDocument(std::move(*document)) : nil, nil);
     });
 }
 
@@ -345,7 +733,7 @@ __attribute__((objc_direct_members))
             return completion(nil, makeError(*error));
         }
 
-        return completion((NSDictionary *)RLMConvertBsonDocumentToRLMBSON(document), nil);
+        return completion(document ? RLMMakeLazyBSONDocument(std::move(*document)) : nil, nil);
     });
 }
 
@@ -369,7 +757,7 @@ __attribute__((objc_direct_members))
             return completion(nil, makeError(*error));
         }
 
-        return completion((NSDictionary *)RLMConvertBsonDocumentToRLMBSON(document), nil);
+        return completion(document ? RLMMakeLazyBSONDocument(std::move(*document)) : nil, nil);
     });
 }
 
@@ -421,6 +809,25 @@ __attribute__((objc_direct_members))
                                  idFilter:(nullable id<RLMBSON>)idFilter
                                  delegate:(id<RLMChangeEventDelegate>)delegate
                                 scheduler:(void (^)(dispatch_block_t))scheduler {
+    auto changeStream = [[RLMChangeStream alloc] initWithChangeEventSubscriber:delegate scheduler:scheduler];
+    return [self openChangeStream:changeStream matchFilter:matchFilter idFilter:idFilter];
+}
+
+- (RLMChangeStream *)watchWithMatchFilter:(nullable NSDictionary<NSString *, id<RLMBSON>> *)matchFilter
+                                filterIds:(nullable NSArray<RLMObjectId *> *)filterIds
+                             batchOptions:(nullable RLMChangeStreamBatchOptions *)options
+                                 delegate:(id<RLMChangeEventBatchDelegate>)delegate
+                            delegateQueue:(nullable dispatch_queue_t)queue {
+    queue = queue ?: dispatch_get_main_queue();
+    auto changeStream = [[RLMChangeStream alloc] initWithBatchSubscriber:delegate
+                                                                 options:options ?: [RLMChangeStreamBatchOptions new]
+                                                               scheduler:^(dispatch_block_t block) { dispatch_async(queue, block); }];
+    return [self openChangeStream:changeStream matchFilter:matchFilter idFilter:filterIds];
+}
+
+- (RLMChangeStream *)openChangeStream:(RLMChangeStream *)changeStream
+                          matchFilter:(nullable id<RLMBSON>)matchFilter
+                             idFilter:(nullable id<RLMBSON>)idFilter {
     realm::bson::BsonDocument baseArgs = {
         {"database", self.databaseName.UTF8String},
         {"collection", self.name.UTF8String}
@@ -436,7 +843,6 @@ __attribute__((objc_direct_members))
     auto app = self.user.user->app();
     auto request = app->make_streaming_request(app->current_user(), "watch", args,
                                                std::optional<std::string>(self.serviceName.UTF8String));
-    auto changeStream = [[RLMChangeStream alloc] initWithChangeEventSubscriber:delegate scheduler:scheduler];
     RLMNetworkTransport *transport = self.user.app.configuration.transport;
     RLMRequest *rlmRequest = RLMRequestFromRequest(request);
     changeStream->_session = [transport doStreamRequest:rlmRequest eventSubscriber:changeStream];
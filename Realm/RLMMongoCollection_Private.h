@@ -32,6 +32,18 @@ RLM_HEADER_AUDIT_BEGIN(nullability)
                                  idFilter:(nullable id<RLMBSON>)idFilter
                                  delegate:(id<RLMChangeEventDelegate>)delegate
                                 scheduler:(void (^)(dispatch_block_t))scheduler;
+
+// Calls the named server function with the given extended JSON arguments,
+// reporting the extended JSON response. Used to substitute for the server
+// when testing chunked inserts.
+typedef void (^RLMMongoFunctionCaller)(NSString *name, NSString *arguments,
+                                       void (^completion)(NSString *_Nullable response, NSError *_Nullable error));
+
+- (void)insertManyDocuments:(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)documents
+                    options:(RLMInsertManyOptions *)options
+                   progress:(nullable RLMMongoInsertProgressBlock)progress
+             functionCaller:(nullable RLMMongoFunctionCaller)functionCaller
+                 completion:(RLMMongoInsertManyBlock)completion;
 @end
 
 RLM_HEADER_AUDIT_END(nullability)
@@ -113,11 +113,55 @@ RLM_SWIFT_SENDABLE // used from multiple threads so must be internally thread-sa
 
 @end
 
+/// Connection statistics for the requests sent by an `RLMNetworkTransport`.
+RLM_SWIFT_SENDABLE RLM_FINAL // immutable final class
+@interface RLMNetworkTransportStatistics : NSObject
+
+/// The number of URL sessions which the transport has created.
+@property (nonatomic, readonly) NSUInteger sessionsCreated;
+
+/// The number of requests which have completed, successfully or otherwise.
+@property (nonatomic, readonly) NSUInteger requestsCompleted;
+
+/// The number of completed requests which were sent over a connection which
+/// was already open rather than a newly established one.
+@property (nonatomic, readonly) NSUInteger reusedConnections;
+
+/// The number of completed requests which were sent using HTTP/2.
+@property (nonatomic, readonly) NSUInteger http2Requests;
+
+@end
+
 /// Transporting protocol for foreign interfaces. Allows for custom
 /// request/response handling.
 RLM_SWIFT_SENDABLE // is internally thread-safe
 @interface RLMNetworkTransport : NSObject<RLMNetworkTransport>
 
+/// Creates a transport which uses a new URL session for each request.
+- (instancetype)init;
+
+/**
+ Creates a transport which optionally keeps a long-lived URL session for each
+ server it sends requests to.
+
+ With persistent connections, all requests to the same scheme, host and port
+ share a single `NSURLSession`. Connections are kept alive between requests,
+ and concurrent requests to HTTP/2 servers are multiplexed over a single
+ connection, rather than each request establishing a new TCP connection and
+ performing a new TLS handshake. The sessions are invalidated when the
+ transport is deallocated.
+
+ @param persistentConnections Whether to reuse URL sessions between requests.
+ */
+- (instancetype)initWithPersistentConnections:(BOOL)persistentConnections;
+
+/// Whether this transport reuses URL sessions between requests.
+@property (nonatomic, readonly) BOOL usesPersistentConnections;
+
+/// A snapshot of the connection statistics for the requests sent by this
+/// transport so far.
+@property (nonatomic, readonly) RLMNetworkTransportStatistics *statistics;
+
 /**
  Sends a request to a given endpoint.
 
@@ -28,6 +28,12 @@
 #import <realm/object-store/sync/generic_network_transport.hpp>
 #import <realm/util/scope_exit.hpp>
 
+#import <algorithm>
+#import <atomic>
+#import <memory>
+#import <string>
+#import <unordered_map>
+
 using namespace realm;
 
 static_assert((int)RLMHTTPMethodGET        == (int)app::HttpMethod::get);
@@ -36,12 +42,86 @@ static_assert((int)RLMHTTPMethodPUT        == (int)app::HttpMethod::put);
 static_assert((int)RLMHTTPMethodPATCH      == (int)app::HttpMethod::patch);
 static_assert((int)RLMHTTPMethodDELETE     == (int)app::HttpMethod::del);
 
+namespace {
+struct TransportCounters {
+    std::atomic<NSUInteger> sessionsCreated{0};
+    std::atomic<NSUInteger> requestsCompleted{0};
+    std::atomic<NSUInteger> reusedConnections{0};
+    std::atomic<NSUInteger> http2Requests{0};
+
+    void record(NSURLSessionTaskMetrics *metrics) {
+        ++requestsCompleted;
+        // Redirects produce multiple transactions; the last one is the
+        // request which actually produced the response
+        NSURLSessionTaskTransactionMetrics *transaction = metrics.transactionMetrics.lastObject;
+        if (transaction.reusedConnection) {
+            ++reusedConnections;
+        }
+        if ([transaction.networkProtocolName isEqualToString:@"h2"]) {
+            ++http2Requests;
+        }
+    }
+};
+
+// Accumulates a response body directly into the string which is eventually
+// handed to core, rather than into an NSData which is then converted to an
+// NSString and then back to a std::string.
+struct ResponseBody {
+    std::string data;
+
+    void reserve(NSURLResponse *response) {
+        // The expected length comes from the server's Content-Length, so only
+        // trust it for a bounded initial allocation
+        constexpr long long maxReservation = 16 * 1024 * 1024;
+        if (long long expected = response.expectedContentLength; expected > 0) {
+            data.reserve(static_cast<size_t>(std::min(expected, maxReservation)));
+        }
+    }
+
+    void append(NSData *chunk) {
+        [chunk enumerateByteRangesUsingBlock:^(const void *bytes, NSRange range, BOOL *) {
+            data.append(static_cast<const char *>(bytes), range.length);
+        }];
+    }
+};
+
+struct PendingTask {
+    RLMNetworkTransportCompletionBlock completion;
+    ResponseBody body;
+};
+} // anonymous namespace
+
 #pragma mark RLMSessionDelegate
 
 @interface RLMSessionDelegate <NSURLSessionDelegate> : NSObject
-+ (instancetype)delegateWithCompletion:(RLMNetworkTransportCompletionBlock)completion;
++ (instancetype)delegateWithCompletion:(RLMNetworkTransportCompletionBlock)completion
+                              counters:(std::shared_ptr<TransportCounters>)counters;
+@end
+
+// Delegate for the long-lived sessions used with persistent connections. One
+// delegate is shared by every request sent over the session, so responses are
+// routed to their completion by task.
+@interface RLMTaskRoutingSessionDelegate <NSURLSessionDelegate> : NSObject
++ (instancetype)delegateWithCounters:(std::shared_ptr<TransportCounters>)counters;
+- (void)addTask:(NSURLSessionTask *)task completion:(RLMNetworkTransportCompletionBlock)completion;
 @end
 
+static RLMResponse *RLMResponseFromTask(NSURLResponse *urlResponse, std::string&& body, NSError *error) {
+    RLMResponse *response = [RLMResponse new];
+    NSHTTPURLResponse *httpResponse = (NSHTTPURLResponse *)urlResponse;
+    response.headers = httpResponse.allHeaderFields;
+    response.httpStatusCode = httpResponse.statusCode;
+
+    if (error) {
+        response.body = error.localizedDescription;
+        response.customStatusCode = error.code;
+        return response;
+    }
+
+    [response setRawBody:std::move(body)];
+    return response;
+}
+
 NSString * const RLMHTTPMethodToNSString[] = {
     [RLMHTTPMethodGET] = @"GET",
     [RLMHTTPMethodPOST] = @"POST",
@@ -53,14 +133,118 @@ NSString * const RLMHTTPMethodToNSString[] = {
 @implementation RLMRequest
 @end
 
-@implementation RLMResponse
+@implementation RLMResponse {
+    // The body is decoded lazily, and responses are handed to completion
+    // blocks which may read it from any thread, so the body state is guarded
+    RLMUnfairMutex _bodyMutex;
+    NSString *_body;
+    std::string _rawBody;
+    bool _hasRawBody;
+}
+
+- (NSString *)body {
+    std::lock_guard lock(_bodyMutex);
+    if (!_body && _hasRawBody) {
+        _body = [[NSString alloc] initWithBytes:_rawBody.data() length:_rawBody.size()
+                                       encoding:NSUTF8StringEncoding];
+    }
+    return _body;
+}
+
+- (void)setBody:(NSString *)body {
+    std::lock_guard lock(_bodyMutex);
+    _body = body;
+    _hasRawBody = false;
+    _rawBody = {};
+}
+
+- (void)setRawBody:(std::string&&)body {
+    std::lock_guard lock(_bodyMutex);
+    _body = nil;
+    _rawBody = std::move(body);
+    _hasRawBody = true;
+}
+
+- (std::string)takeBody {
+    std::lock_guard lock(_bodyMutex);
+    if (_hasRawBody) {
+        _hasRawBody = false;
+        return std::move(_rawBody);
+    }
+    return _body ? _body.UTF8String : "";
+}
+@end
+
+@implementation RLMNetworkTransportStatistics
+- (instancetype)initWithCounters:(TransportCounters const&)counters {
+    if (self = [super init]) {
+        _sessionsCreated = counters.sessionsCreated;
+        _requestsCompleted = counters.requestsCompleted;
+        _reusedConnections = counters.reusedConnections;
+        _http2Requests = counters.http2Requests;
+    }
+    return self;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"RLMNetworkTransportStatistics {\n\tsessionsCreated: %lu\n\trequestsCompleted: %lu\n"
+            "\treusedConnections: %lu\n\thttp2Requests: %lu\n}",
+            (unsigned long)_sessionsCreated, (unsigned long)_requestsCompleted,
+            (unsigned long)_reusedConnections, (unsigned long)_http2Requests];
+}
 @end
 
 @interface RLMEventSessionDelegate <NSURLSessionDelegate> : NSObject
 + (instancetype)delegateWithEventSubscriber:(id<RLMEventDelegate>)subscriber;
 @end;
 
-@implementation RLMNetworkTransport
+@implementation RLMNetworkTransport {
+    std::shared_ptr<TransportCounters> _counters;
+    // Long-lived sessions keyed by scheme, host and port. Only used with
+    // persistent connections.
+    RLMUnfairMutex _sessionsMutex;
+    NSMutableDictionary<NSString *, NSURLSession *> *_sessions;
+}
+
+- (instancetype)init {
+    return [self initWithPersistentConnections:NO];
+}
+
+- (instancetype)initWithPersistentConnections:(BOOL)persistentConnections {
+    if (self = [super init]) {
+        _usesPersistentConnections = persistentConnections;
+        _counters = std::make_shared<TransportCounters>();
+        if (persistentConnections) {
+            _sessions = [NSMutableDictionary new];
+        }
+    }
+    return self;
+}
+
+- (void)dealloc {
+    for (NSURLSession *session in _sessions.allValues) {
+        [session finishTasksAndInvalidate];
+    }
+}
+
+- (RLMNetworkTransportStatistics *)statistics {
+    return [[RLMNetworkTransportStatistics alloc] initWithCounters:*_counters];
+}
+
+- (NSURLSession *)sessionForURL:(NSURL *)url {
+    NSString *key = [NSString stringWithFormat:@"%@://%@:%@", url.scheme.lowercaseString,
+                     url.host.lowercaseString, url.port ?: @""];
+    std::lock_guard lock(_sessionsMutex);
+    NSURLSession *session = _sessions[key];
+    if (!session) {
+        id delegate = [RLMTaskRoutingSessionDelegate delegateWithCounters:_counters];
+        session = [NSURLSession sessionWithConfiguration:NSURLSessionConfiguration.defaultSessionConfiguration
+                                                delegate:delegate delegateQueue:nil];
+        _sessions[key] = session;
+        ++_counters->sessionsCreated;
+    }
+    return session;
+}
 
 - (void)sendRequestToServer:(RLMRequest *)request
                  completion:(RLMNetworkTransportCompletionBlock)completionBlock {
@@ -76,9 +260,19 @@ NSString * const RLMHTTPMethodToNSString[] = {
     for (NSString *key in request.headers) {
         [urlRequest addValue:request.headers[key] forHTTPHeaderField:key];
     }
-    id delegate = [RLMSessionDelegate delegateWithCompletion:completionBlock];
+
+    if (_usesPersistentConnections) {
+        NSURLSession *session = [self sessionForURL:requestURL];
+        NSURLSessionDataTask *task = [session dataTaskWithRequest:urlRequest];
+        [(RLMTaskRoutingSessionDelegate *)session.delegate addTask:task completion:completionBlock];
+        [task resume];
+        return;
+    }
+
+    id delegate = [RLMSessionDelegate delegateWithCompletion:completionBlock counters:_counters];
     auto session = [NSURLSession sessionWithConfiguration:NSURLSessionConfiguration.defaultSessionConfiguration
                                                  delegate:delegate delegateQueue:nil];
+    ++_counters->sessionsCreated;
 
     // Add the request to a task and start it
     [[session dataTaskWithRequest:urlRequest] resume];
@@ -124,47 +318,114 @@ RLMRequest *RLMRequestFromRequest(realm::app::Request const& request) {
 #pragma mark RLMSessionDelegate
 
 @implementation RLMSessionDelegate {
-    NSData *_data;
+    ResponseBody _body;
     RLMNetworkTransportCompletionBlock _completionBlock;
+    std::shared_ptr<TransportCounters> _counters;
 }
 
-+ (instancetype)delegateWithCompletion:(RLMNetworkTransportCompletionBlock)completion {
++ (instancetype)delegateWithCompletion:(RLMNetworkTransportCompletionBlock)completion
+                              counters:(std::shared_ptr<TransportCounters>)counters {
     RLMSessionDelegate *delegate = [RLMSessionDelegate new];
     delegate->_completionBlock = completion;
+    delegate->_counters = std::move(counters);
     return delegate;
 }
 
+- (void)URLSession:(__unused NSURLSession *)session
+          dataTask:(__unused NSURLSessionDataTask *)dataTask
+didReceiveResponse:(NSURLResponse *)response
+ completionHandler:(void (^)(NSURLSessionResponseDisposition))completionHandler {
+    _body.reserve(response);
+    completionHandler(NSURLSessionResponseAllow);
+}
+
 - (void)URLSession:(__unused NSURLSession *)session
           dataTask:(__unused NSURLSessionDataTask *)dataTask
     didReceiveData:(NSData *)data {
-    if (!_data) {
-        _data = data;
-        return;
-    }
-    if (![_data respondsToSelector:@selector(appendData:)]) {
-        _data = [_data mutableCopy];
-    }
-    [(id)_data appendData:data];
+    _body.append(data);
+}
+
+- (void)URLSession:(__unused NSURLSession *)session
+              task:(__unused NSURLSessionTask *)task
+didFinishCollectingMetrics:(NSURLSessionTaskMetrics *)metrics {
+    _counters->record(metrics);
 }
 
 - (void)URLSession:(__unused NSURLSession *)session
               task:(NSURLSessionTask *)task
 didCompleteWithError:(NSError *)error
 {
-    RLMResponse *response = [RLMResponse new];
-    NSHTTPURLResponse *httpResponse = (NSHTTPURLResponse *) task.response;
-    response.headers = httpResponse.allHeaderFields;
-    response.httpStatusCode = httpResponse.statusCode;
+    _completionBlock(RLMResponseFromTask(task.response, std::move(_body.data), error));
+}
 
-    if (error) {
-        response.body = error.localizedDescription;
-        response.customStatusCode = error.code;
-        return _completionBlock(response);
+@end
+
+@implementation RLMTaskRoutingSessionDelegate {
+    std::shared_ptr<TransportCounters> _counters;
+    // Tasks are added from whichever thread sends the request, while the
+    // other delegate methods are called on the session's serial delegate
+    // queue. Entries are only removed on the delegate queue, so a pointer to
+    // an entry remains valid there without holding the lock.
+    RLMUnfairMutex _mutex;
+    std::unordered_map<NSUInteger, PendingTask> _tasks;
+}
+
++ (instancetype)delegateWithCounters:(std::shared_ptr<TransportCounters>)counters {
+    RLMTaskRoutingSessionDelegate *delegate = [RLMTaskRoutingSessionDelegate new];
+    delegate->_counters = std::move(counters);
+    return delegate;
+}
+
+- (void)addTask:(NSURLSessionTask *)task completion:(RLMNetworkTransportCompletionBlock)completion {
+    std::lock_guard lock(_mutex);
+    _tasks[task.taskIdentifier] = PendingTask{completion, {}};
+}
+
+- (PendingTask *)pendingTask:(NSURLSessionTask *)task {
+    std::lock_guard lock(_mutex);
+    auto it = _tasks.find(task.taskIdentifier);
+    return it == _tasks.end() ? nullptr : &it->second;
+}
+
+- (void)URLSession:(__unused NSURLSession *)session
+          dataTask:(NSURLSessionDataTask *)dataTask
+didReceiveResponse:(NSURLResponse *)response
+ completionHandler:(void (^)(NSURLSessionResponseDisposition))completionHandler {
+    if (auto pending = [self pendingTask:dataTask]) {
+        pending->body.reserve(response);
+    }
+    completionHandler(NSURLSessionResponseAllow);
+}
+
+- (void)URLSession:(__unused NSURLSession *)session
+          dataTask:(NSURLSessionDataTask *)dataTask
+    didReceiveData:(NSData *)data {
+    if (auto pending = [self pendingTask:dataTask]) {
+        pending->body.append(data);
     }
+}
 
-    response.body = [[NSString alloc] initWithData:_data encoding:NSUTF8StringEncoding];
+- (void)URLSession:(__unused NSURLSession *)session
+              task:(__unused NSURLSessionTask *)task
+didFinishCollectingMetrics:(NSURLSessionTaskMetrics *)metrics {
+    _counters->record(metrics);
+}
 
-    _completionBlock(response);
+- (void)URLSession:(__unused NSURLSession *)session
+              task:(NSURLSessionTask *)task
+didCompleteWithError:(NSError *)error
+{
+    PendingTask pending;
+    {
+        std::lock_guard lock(_mutex);
+        auto it = _tasks.find(task.taskIdentifier);
+        if (it == _tasks.end()) {
+            return;
+        }
+        pending = std::move(it->second);
+        _tasks.erase(it);
+    }
+    pending.completion(RLMResponseFromTask(task.response, std::move(pending.body.data), error));
 }
 
 @end
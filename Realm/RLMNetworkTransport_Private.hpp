@@ -18,8 +18,19 @@
 
 #import "RLMNetworkTransport.h"
 
+#import <string>
+
 namespace realm::app {
 struct Request;
 }
 
+@interface RLMResponse ()
+// Sets the body to the raw bytes received from the server. The NSString
+// `body` is only created from these if something reads it, so that the bytes
+// can be handed to core without a round trip through NSString.
+- (void)setRawBody:(std::string&&)body;
+// Returns the body as UTF-8, moving out of the raw body if there is one.
+- (std::string)takeBody;
+@end
+
 RLMRequest *RLMRequestFromRequest(realm::app::Request const& request);
@@ -395,6 +395,20 @@ RLM_HEADER_AUDIT_BEGIN(nullability, sendability)
  */
 + (nullable NSString *)primaryKey;
 
+/**
+ Override this method to make managed objects of this type without a primary
+ key use the object they refer to as their identity for `isEqual:` and `hash`.
+
+ By default, non-frozen objects without a primary key use pointer identity.
+ When this returns `YES`, two accessors for the same object in the same Realm
+ compare equal and have the same hash. Note that this means an unmanaged
+ object's hash changes when it is added to a Realm, so it must not be in a hashed
+ collection at that point.
+
+ @return    Whether objects of this type use a stable identity. Defaults to `NO`.
+ */
++ (BOOL)usesStableIdentity;
+
 /**
  Override this method to specify the names of properties to ignore. These properties will not be managed by the Realm
  that manages the object.
@@ -708,7 +722,8 @@ typedef void (^RLMObjectChangeBlock)(BOOL deleted,
  For frozen objects and object types with a primary key, `isEqual:` is
  overridden to use the same logic as this method (along with a corresponding
  implementation for `hash`). Non-frozen objects without primary keys use
- pointer identity for `isEqual:` and `hash`.
+ pointer identity for `isEqual:` and `hash` unless `usesStableIdentity` is
+ overridden to return `YES`.
 
  @param object  The object to compare the receiver to.
 
@@ -22,6 +22,7 @@
 #import "RLMAccessor.h"
 #import "RLMArray_Private.hpp"
 #import "RLMDecimal128.h"
+#import "RLMObjectId_Private.hpp"
 #import "RLMObjectSchema_Private.hpp"
 #import "RLMObjectStore.h"
 #import "RLMObservation.hpp"
@@ -301,20 +302,69 @@ id RLMCreateManagedAccessor(Class cls, RLMClassInfo *info) {
 
 - (BOOL)isEqual:(id)object {
     if (RLMObjectBase *other = RLMDynamicCast<RLMObjectBase>(object)) {
-        if (_objectSchema.primaryKeyProperty || _realm.isFrozen) {
+        if (_objectSchema.primaryKeyProperty || _realm.isFrozen || _objectSchema.usesStableIdentity) {
             return RLMObjectBaseAreEqual(self, other);
         }
     }
     return [super isEqual:object];
 }
 
+// Primary key values are hashed from their raw value in the same way whether
+// they were read from the Realm or from an unmanaged object's boxed property,
+// so that adding an object to a Realm doesn't change its hash.
+static NSUInteger hashPrimaryKey(realm::Mixed const& value) {
+    if (value.is_null()) {
+        return 1;
+    }
+    // modify the hash to avoid potential (although unlikely) collisions with
+    // the hash of the object key used for frozen objects
+    return static_cast<NSUInteger>(value.hash()) ^ 1;
+}
+
+static std::optional<realm::Mixed> unmanagedPrimaryKey(__unsafe_unretained id const value, RLMPropertyType type) {
+    if (!value || value == NSNull.null) {
+        return realm::Mixed();
+    }
+    switch (type) {
+        case RLMPropertyTypeInt:
+            if (auto number = RLMDynamicCast<NSNumber>(value)) {
+                return realm::Mixed(number.longLongValue);
+            }
+            break;
+        case RLMPropertyTypeString:
+            if (auto string = RLMDynamicCast<NSString>(value)) {
+                return realm::Mixed(RLMStringDataWithNSString(string));
+            }
+            break;
+        case RLMPropertyTypeObjectId:
+            if (auto objectId = RLMDynamicCast<RLMObjectId>(value)) {
+                return realm::Mixed(objectId.value);
+            }
+            break;
+        case RLMPropertyTypeUUID:
+            if (auto uuid = RLMDynamicCast<NSUUID>(value)) {
+                return realm::Mixed(RLMObjcToUUID(uuid));
+            }
+            break;
+        default:
+            break;
+    }
+    return std::nullopt;
+}
+
 - (NSUInteger)hash {
-    if (_objectSchema.primaryKeyProperty) {
+    if (RLMProperty *primaryKeyProperty = _objectSchema.primaryKeyProperty) {
         // If we have a primary key property, that's an immutable value which we
-        // can use as the identity of the object.
-        id primaryProperty = [self valueForKey:_objectSchema.primaryKeyProperty.name];
-
-        // modify the hash of our primary key value to avoid potential (although unlikely) collisions
+        // can use as the identity of the object. Managed objects read it
+        // directly from the row rather than boxing it.
+        if (_realm) {
+            RLMVerifyAttached(self);
+            return hashPrimaryKey(_row.get_any(_info->tableColumn(primaryKeyProperty)));
+        }
+        id primaryProperty = [self valueForKey:primaryKeyProperty.name];
+        if (auto value = unmanagedPrimaryKey(primaryProperty, primaryKeyProperty.type)) {
+            return hashPrimaryKey(*value);
+        }
         return [primaryProperty hash] ^ 1;
     }
     else if (_realm.isFrozen) {
@@ -322,6 +372,13 @@ id RLMCreateManagedAccessor(Class cls, RLMClassInfo *info) {
         // for objects without primary keys
         return static_cast<NSUInteger>(_row.get_key().value);
     }
+    else if (_realm && _objectSchema.usesStableIdentity) {
+        // Live objects don't change which object they refer to either, but
+        // using that as the identity is opt-in as it means an unmanaged
+        // object's hash changes when it's added to a Realm
+        auto h = std::hash<int64_t>()(_info->objectSchema->table_key.value);
+        return static_cast<NSUInteger>(h ^ (std::hash<int64_t>()(_row.get_key().value) + 0x9e3779b9 + (h << 6) + (h >> 2)));
+    }
     else {
         // Non-frozen objects without primary keys don't have any immutable
         // concept of identity that we can hash so we have to fall back to
@@ -338,6 +395,10 @@ id RLMCreateManagedAccessor(Class cls, RLMClassInfo *info) {
     return nil;
 }
 
++ (BOOL)usesStableIdentity {
+    return NO;
+}
+
 + (NSString *)_realmObjectName {
     return nil;
 }
@@ -539,6 +600,68 @@ id RLMObjectThaw(RLMObjectBase *obj) {
     return resolveObject(obj, obj->_realm.thaw);
 }
 
+// Resolve each of the objects, which must all be managed by `source`, in
+// `target`. Batches are usually all of a single type, so the target class info
+// and table are only looked up when the type changes rather than per object.
+static NSArray *resolveObjects(NSArray *objects, RLMRealm *source, RLMRealm *target, bool freezing) {
+    NSMutableArray *resolved = [NSMutableArray arrayWithCapacity:objects.count];
+    RLMClassInfo *sourceInfo = nullptr;
+    RLMClassInfo *targetInfo = nullptr;
+    Class accessorClass = nil;
+    realm::TableRef table;
+    for (RLMObjectBase *obj in objects) {
+        if (![obj isKindOfClass:[RLMObjectBase class]]) {
+            @throw RLMException(@"Cannot %@ object of type '%@'.",
+                                freezing ? @"freeze" : @"thaw", [obj class]);
+        }
+        if (!obj->_realm && !obj.isInvalidated) {
+            @throw RLMException(@"Unmanaged objects cannot be %@.", freezing ? @"frozen" : @"thawed");
+        }
+        RLMVerifyAttached(obj);
+        if (obj->_realm != source) {
+            @throw RLMException(@"Cannot %@ an object managed by a different Realm.",
+                                freezing ? @"freeze" : @"thaw");
+        }
+        if (source == target) {
+            [resolved addObject:obj];
+            continue;
+        }
+
+        if (obj->_info != sourceInfo) {
+            sourceInfo = obj->_info;
+            targetInfo = &target->_info[sourceInfo->rlmObjectSchema.className];
+            table = targetInfo->table();
+            accessorClass = obj.class;
+            if (!table && freezing) {
+                @throw RLMException(@"Cannot freeze an object of type '%@' because the type does not exist in the frozen version of the Realm.",
+                                    sourceInfo->rlmObjectSchema.className);
+            }
+        }
+        auto row = table ? table->try_get_object(obj->_row.get_key()) : realm::Obj();
+        if (!row.is_valid()) {
+            if (freezing) {
+                @throw RLMException(@"Cannot freeze an object in the same write transaction as it was created in.");
+            }
+            [resolved addObject:NSNull.null];
+            continue;
+        }
+
+        RLMObjectBase *object = RLMCreateManagedAccessor(accessorClass, targetInfo);
+        object->_row = std::move(row);
+        RLMInitializeSwiftAccessor(object, false);
+        [resolved addObject:object];
+    }
+    return resolved;
+}
+
+NSArray *RLMObjectsFreeze(RLMRealm *realm, NSArray *objects) {
+    return resolveObjects(objects, realm, realm.freeze, true);
+}
+
+NSArray *RLMObjectsThaw(RLMRealm *realm, NSArray *objects) {
+    return resolveObjects(objects, realm, realm.thaw, false);
+}
+
 id RLMValidatedValueForProperty(id object, NSString *key, NSString *className) {
     @try {
         return [object valueForKey:key];
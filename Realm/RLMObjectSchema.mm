@@ -23,7 +23,7 @@
 #import "RLMProperty_Private.hpp"
 #import "RLMRealm_Dynamic.h"
 #import "RLMRealm_Private.hpp"
-#import "RLMSchema_Private.h"
+#import "RLMSchema_Private.hpp"
 #import "RLMSwiftCollectionBase.h"
 #import "RLMSwiftSupport.h"
 #import "RLMUtil.hpp"
@@ -31,6 +31,8 @@
 #import <realm/object-store/object_schema.hpp>
 #import <realm/object-store/object_store.hpp>
 
+#import <atomic>
+
 using namespace realm;
 
 @protocol RLMCustomEventRepresentable
@@ -44,6 +46,8 @@ using namespace realm;
 
 @implementation RLMObjectSchema {
     std::string _objectStoreName;
+    std::atomic<bool> _accessorsPending;
+    std::atomic<bool> _accessorsCreated;
 }
 
 - (instancetype)initWithClassName:(NSString *)objectClassName objectClass:(Class)objectClass properties:(NSArray *)properties {
@@ -56,6 +60,36 @@ using namespace realm;
     return self;
 }
 
+- (Class)accessorClass {
+    if (_accessorsPending.load(std::memory_order_acquire)) {
+        RLMSchemaCreatePendingAccessors(self);
+    }
+    return _accessorClass;
+}
+
+- (Class)unmanagedClass {
+    if (_accessorsPending.load(std::memory_order_acquire)) {
+        RLMSchemaCreatePendingAccessors(self);
+    }
+    return _unmanagedClass;
+}
+
+- (bool)accessorsPending {
+    return _accessorsPending.load(std::memory_order_acquire);
+}
+
+- (void)setAccessorsPending:(bool)accessorsPending {
+    _accessorsPending.store(accessorsPending, std::memory_order_release);
+}
+
+- (bool)accessorsCreated {
+    return _accessorsCreated.load(std::memory_order_acquire);
+}
+
+- (void)setAccessorsCreated:(bool)accessorsCreated {
+    _accessorsCreated.store(accessorsCreated, std::memory_order_release);
+}
+
 // return properties by name
 - (RLMProperty *)objectForKeyedSubscript:(__unsafe_unretained NSString *const)key {
     return _allPropertiesByName[key];
@@ -139,6 +173,7 @@ using namespace realm;
     schema.unmanagedClass = objectClass;
     schema.isSwiftClass = isSwift;
     schema.hasCustomEventSerialization = [objectClass conformsToProtocol:@protocol(RLMCustomEventRepresentable)];
+    schema.usesStableIdentity = [objectClass usesStableIdentity];
 
     bool isEmbedded = [(id)objectClass isEmbedded];
     bool isAsymmetric = [(id)objectClass isAsymmetric];
@@ -297,6 +332,7 @@ using namespace realm;
     schema->_isSwiftClass = _isSwiftClass;
     schema->_isEmbedded = _isEmbedded;
     schema->_isAsymmetric = _isAsymmetric;
+    schema->_usesStableIdentity = _usesStableIdentity;
     schema->_properties = [[NSArray allocWithZone:zone] initWithArray:_properties copyItems:YES];
     schema->_computedProperties = [[NSArray allocWithZone:zone] initWithArray:_computedProperties copyItems:YES];
     [schema _propertiesDidChange];
@@ -44,6 +44,10 @@ RLM_HEADER_AUDIT_BEGIN(nullability)
 
 @property (nonatomic, readwrite, assign) bool hasCustomEventSerialization;
 
+// Whether managed objects without a primary key compare and hash by the
+// object they refer to rather than by accessor identity
+@property (nonatomic, readwrite, assign) bool usesStableIdentity;
+
 @property (nonatomic, readwrite, nullable) RLMProperty *primaryKeyProperty;
 
 @property (nonatomic, copy) NSArray<RLMProperty *> *computedProperties;
@@ -33,4 +33,13 @@ namespace realm {
 
 // initialize with realm::ObjectSchema
 + (instancetype)objectSchemaForObjectStoreSchema:(realm::ObjectSchema const&)objectSchema;
+
+// Whether the accessor classes have not yet been created and will be the next
+// time accessorClass or unmanagedClass is read
+@property (nonatomic) bool accessorsPending;
+
+// Whether accessorClass and unmanagedClass have both been set to their final
+// values. Set with release semantics only after both are assigned, so that
+// other threads can check it without taking the schema lock.
+@property (nonatomic) bool accessorsCreated;
 @end
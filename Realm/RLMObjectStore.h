@@ -43,6 +43,11 @@ void RLMVerifyInWriteTransaction(RLMRealm *const realm);
 // add an object to the given realm
 void RLMAddObjectToRealm(RLMObjectBase *object, RLMRealm *realm, RLMUpdatePolicy);
 
+// add each object in an enumerable collection to the given realm, only looking
+// up the class info and creating the accessor context once for each run of
+// objects of the same type
+void RLMAddObjectsToRealm(id<NSFastEnumeration> objects, RLMRealm *realm, RLMUpdatePolicy);
+
 // delete an object from its realm
 void RLMDeleteObjectFromRealm(RLMObjectBase *object, RLMRealm *realm);
 
@@ -61,6 +66,25 @@ RLMObjectBase *RLMCreateObjectInRealmWithValue(RLMRealm *realm, NSString *classN
                                                id _Nullable value, RLMUpdatePolicy updatePolicy)
 NS_RETURNS_RETAINED;
 
+// create an object of the given type from each array or dictionary in an
+// enumerable collection, only looking up the class info and creating the
+// accessor context once. Returns the created objects, or nil without creating
+// any accessors if `returnObjects` is false. `progress` is called with the
+// number of objects created so far after every `batchSize` objects and once at
+// the end.
+NSArray<RLMObjectBase *> *_Nullable
+RLMCreateObjectsInRealmWithValues(RLMRealm *realm, NSString *className,
+                                  id<NSFastEnumeration> values, RLMUpdatePolicy updatePolicy,
+                                  bool returnObjects, NSUInteger batchSize,
+                                  void (^_Nullable progress)(NSUInteger count))
+NS_RETURNS_RETAINED;
+
+// create `count` objects of the given type from column-oriented buffers of
+// unboxed values keyed by property name, writing them directly to the table
+// without converting each value to and from an Objective-C object
+void RLMCreateObjectsInRealmWithColumns(RLMRealm *realm, NSString *className, NSUInteger count,
+                                        NSDictionary<NSString *, NSData *> *columns);
+
 // creates an asymmetric object and doesn't return
 void RLMCreateAsymmetricObjectInRealm(RLMRealm *realm, NSString *className, id value);
 
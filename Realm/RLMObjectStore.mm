@@ -39,6 +39,7 @@
 #import <realm/group.hpp>
 
 #import <objc/message.h>
+#import <deque>
 
 static inline void RLMVerifyRealmRead(__unsafe_unretained RLMRealm *const realm) {
     if (!realm) {
@@ -118,6 +119,37 @@ void RLMAddObjectToRealm(__unsafe_unretained RLMObjectBase *const object,
     c.createObject(object, createPolicy);
 }
 
+void RLMAddObjectsToRealm(id<NSFastEnumeration> objects,
+                          __unsafe_unretained RLMRealm *const realm,
+                          RLMUpdatePolicy updatePolicy) {
+    RLMVerifyInWriteTransaction(realm);
+
+    CreatePolicy createPolicy = updatePolicyToCreatePolicy(updatePolicy);
+    createPolicy.copy = false;
+
+    // Objects being added in bulk are nearly always all of the same type, so
+    // only look up the class info when the type changes
+    __unsafe_unretained RLMObjectSchema *currentSchema = nil;
+    std::optional<RLMAccessorContext> c;
+    for (RLMObjectBase *object in objects) {
+        if (![object isKindOfClass:RLMObjectBase.class]) {
+            @throw RLMException(@"Cannot %@ objects of type %@ with %@. Only RLMObjects are supported.",
+                                updatePolicy == RLMUpdatePolicyError ? @"insert" : @"add or update",
+                                NSStringFromClass(object.class),
+                                updatePolicy == RLMUpdatePolicyError ? @"addObjects:" : @"addOrUpdateObjects:");
+        }
+        if (object->_objectSchema != currentSchema) {
+            currentSchema = object->_objectSchema;
+            if (updatePolicy != RLMUpdatePolicyError && !currentSchema.primaryKeyProperty) {
+                @throw RLMException(@"'%@' does not have a primary key and can not be updated",
+                                    currentSchema.className);
+            }
+            c.emplace(realm->_info[currentSchema.className]);
+        }
+        c->createObject(object, createPolicy);
+    }
+}
+
 RLMObjectBase *RLMCreateObjectInRealmWithValue(RLMRealm *realm, NSString *className,
                                                id value, RLMUpdatePolicy updatePolicy) {
     RLMVerifyInWriteTransaction(realm);
@@ -137,6 +169,319 @@ RLMObjectBase *RLMCreateObjectInRealmWithValue(RLMRealm *realm, NSString *classN
     return object;
 }
 
+NSArray *RLMCreateObjectsInRealmWithValues(RLMRealm *realm, NSString *className,
+                                           id<NSFastEnumeration> values, RLMUpdatePolicy updatePolicy,
+                                           bool returnObjects, NSUInteger batchSize,
+                                           void (^progress)(NSUInteger)) {
+    RLMVerifyInWriteTransaction(realm);
+
+    CreatePolicy createPolicy = updatePolicyToCreatePolicy(updatePolicy);
+    createPolicy.copy = true;
+
+    auto& info = realm->_info[className];
+    if (updatePolicy != RLMUpdatePolicyError && !info.propertyForPrimaryKey()) {
+        @throw RLMException(@"'%@' does not have a primary key and can not be updated", className);
+    }
+
+    RLMAccessorContext c{info};
+    Class accessorClass = info.rlmObjectSchema.accessorClass;
+    NSMutableArray *objects = returnObjects ? [NSMutableArray new] : nil;
+    NSUInteger count = 0;
+    for (id value in values) {
+        // Drain any temporaries created while unboxing each value so that
+        // very large imports don't accumulate them until the end
+        @autoreleasepool {
+            auto [obj, reuseExisting] = c.createObject(value, createPolicy, true);
+            if (objects) {
+                if (reuseExisting) {
+                    [objects addObject:value];
+                }
+                else {
+                    RLMObjectBase *object = RLMCreateManagedAccessor(accessorClass, &info);
+                    object->_row = std::move(obj);
+                    RLMInitializeSwiftAccessor(object, false);
+                    [objects addObject:object];
+                }
+            }
+        }
+        ++count;
+        if (progress && batchSize && count % batchSize == 0) {
+            progress(count);
+        }
+    }
+    if (progress && (!batchSize || count % batchSize != 0 || count == 0)) {
+        progress(count);
+    }
+    return objects;
+}
+
+namespace {
+// A column of values being imported for a single property. Strings are stored
+// back-to-back with a NUL terminator, so they're read sequentially rather than
+// by index.
+struct ImportColumn {
+    realm::ColKey col;
+    RLMPropertyType type;
+    const char *data;
+
+    template<typename T>
+    T get(NSUInteger i) const {
+        T value;
+        memcpy(&value, data + i * sizeof(T), sizeof(T));
+        return value;
+    }
+
+    realm::StringData nextString() {
+        realm::StringData str(data);
+        data += str.size() + 1;
+        return str;
+    }
+};
+
+// Check if the bytes are valid UTF-8, rejecting overlong encodings, surrogates
+// and code points past U+10FFFF as NSString does
+bool isValidUTF8(const unsigned char *it, const unsigned char *end) {
+    while (it < end) {
+        unsigned char c = *it++;
+        if (c < 0x80) {
+            continue;
+        }
+        size_t continuationBytes;
+        uint32_t codePoint, minimum;
+        if ((c & 0xE0) == 0xC0) {
+            continuationBytes = 1;
+            codePoint = c & 0x1F;
+            minimum = 0x80;
+        }
+        else if ((c & 0xF0) == 0xE0) {
+            continuationBytes = 2;
+            codePoint = c & 0x0F;
+            minimum = 0x800;
+        }
+        else if ((c & 0xF8) == 0xF0) {
+            continuationBytes = 3;
+            codePoint = c & 0x07;
+            minimum = 0x10000;
+        }
+        else {
+            return false;
+        }
+        if (static_cast<size_t>(end - it) < continuationBytes) {
+            return false;
+        }
+        for (size_t i = 0; i < continuationBytes; ++i) {
+            if ((*it & 0xC0) != 0x80) {
+                return false;
+            }
+            codePoint = (codePoint << 6) | (*it++ & 0x3F);
+        }
+        if (codePoint < minimum || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t importElementSize(RLMPropertyType type) {
+    switch (type) {
+        case RLMPropertyTypeInt:    return sizeof(int64_t);
+        case RLMPropertyTypeBool:   return sizeof(bool);
+        case RLMPropertyTypeFloat:  return sizeof(float);
+        case RLMPropertyTypeDouble: return sizeof(double);
+        case RLMPropertyTypeDate:   return sizeof(double);
+        case RLMPropertyTypeString: return 0;
+        default: return SIZE_MAX;
+    }
+}
+
+// Converts a property's default value to the representation stored in the
+// column once up front so that it can be set on every created object
+realm::Mixed importDefaultValue(RLMRealm *realm, RLMProperty *prop, id value,
+                                std::deque<std::string>& strings) {
+    switch (prop.type) {
+        case RLMPropertyTypeInt:    return [value longLongValue];
+        case RLMPropertyTypeBool:   return (bool)[value boolValue];
+        case RLMPropertyTypeFloat:  return [value floatValue];
+        case RLMPropertyTypeDouble: return [value doubleValue];
+        case RLMPropertyTypeDate:   return RLMTimestampForNSDate(value);
+        case RLMPropertyTypeString:
+            strings.emplace_back();
+            RLMNSStringToStdString(strings.back(), value);
+            return realm::StringData(strings.back());
+        default:
+            return RLMObjcToMixed(value, realm);
+    }
+}
+} // anonymous namespace
+
+void RLMCreateObjectsInRealmWithColumns(RLMRealm *realm, NSString *className, NSUInteger count,
+                                        NSDictionary<NSString *, NSData *> *columns) {
+    RLMVerifyInWriteTransaction(realm);
+
+    auto& info = realm->_info[className];
+    RLMObjectSchema *objectSchema = info.rlmObjectSchema;
+    if (objectSchema.isEmbedded) {
+        @throw RLMException(@"Cannot create objects of embedded type '%@' from columns: embedded objects "
+                            @"can only be created as part of a parent object.", className);
+    }
+    for (NSString *name in columns) {
+        if (!objectSchema[name]) {
+            @throw RLMException(@"Invalid property name '%@' for class '%@'.", name, className);
+        }
+    }
+
+    // Validate each column and resolve everything which doesn't vary per
+    // object once so that the loop below only has to read and set values
+    RLMProperty *primaryKeyProperty = info.propertyForPrimaryKey();
+    std::optional<ImportColumn> primaryKeyColumn;
+    realm::Mixed primaryKeyDefault;
+    std::vector<ImportColumn> imported;
+    std::vector<std::pair<realm::ColKey, realm::Mixed>> defaults;
+    std::deque<std::string> defaultStrings;
+    NSDictionary *defaultValues = RLMDefaultValuesForObjectSchema(objectSchema);
+
+    for (RLMProperty *prop in objectSchema.properties) {
+        NSData *data = columns[prop.name];
+        if (!data) {
+            id defaultValue = defaultValues[prop.name];
+            if (prop.collection || prop.type == RLMPropertyTypeObject) {
+                if (defaultValue) {
+                    @throw RLMException(@"Cannot apply the default value for property '%@.%@' when creating "
+                                        @"objects from columns: only non-collection, non-link properties "
+                                        @"support default values in columnar imports.",
+                                        className, prop.name);
+                }
+                continue;
+            }
+            if (!defaultValue || defaultValue == NSNull.null) {
+                if (!prop.optional) {
+                    @throw RLMException(@"Missing value for property '%@.%@'", className, prop.name);
+                }
+                continue;
+            }
+            RLMValidateValueForProperty(defaultValue, objectSchema, prop);
+            auto value = importDefaultValue(realm, prop, defaultValue, defaultStrings);
+            if (prop == primaryKeyProperty) {
+                primaryKeyDefault = value;
+            }
+            else {
+                defaults.emplace_back(info.tableColumn(prop), value);
+            }
+            continue;
+        }
+
+        size_t elementSize = prop.collection ? SIZE_MAX : importElementSize(prop.type);
+        if (elementSize == SIZE_MAX) {
+            @throw RLMException(@"Property '%@.%@' of type '%@' cannot be created from a column. Only "
+                                @"int, bool, float, double, date and string properties are supported.",
+                                className, prop.name, RLMTypeToString(prop.type));
+        }
+        if (elementSize) {
+            if (data.length % elementSize || data.length / elementSize != count) {
+                @throw RLMException(@"Column for property '%@.%@' has %llu bytes, but %llu values of %zu "
+                                    @"bytes each were expected.", className, prop.name,
+                                    (unsigned long long)data.length, (unsigned long long)count, elementSize);
+            }
+        }
+        else {
+            // Verify that there are exactly `count` terminated strings so
+            // that reading them sequentially can't run off the end
+            auto it = static_cast<const char *>(data.bytes), end = it + data.length;
+            NSUInteger found = 0;
+            while (it < end) {
+                auto terminator = static_cast<const char *>(memchr(it, '\0', end - it));
+                if (!terminator) {
+                    break;
+                }
+                // Strings set through the accessors always come from an
+                // NSString and so are valid UTF-8, so apply the same check
+                // to the raw bytes before they're handed to core
+                if (!isValidUTF8(reinterpret_cast<const unsigned char *>(it),
+                                 reinterpret_cast<const unsigned char *>(terminator))) {
+                    @throw RLMException(@"Column for property '%@.%@' contains invalid UTF-8 in value %llu.",
+                                        className, prop.name, (unsigned long long)found);
+                }
+                it = terminator + 1;
+                ++found;
+            }
+            if (found != count || it != end) {
+                @throw RLMException(@"Column for property '%@.%@' must contain exactly %llu NUL-terminated "
+                                    @"UTF-8 strings.", className, prop.name, (unsigned long long)count);
+            }
+        }
+
+        ImportColumn column{info.tableColumn(prop), prop.type, static_cast<const char *>(data.bytes)};
+        if (prop == primaryKeyProperty) {
+            primaryKeyColumn = column;
+        }
+        else {
+            imported.push_back(column);
+        }
+    }
+
+    auto table = info.table();
+    try {
+        for (NSUInteger i = 0; i < count; ++i) {
+            realm::Obj obj;
+            if (primaryKeyProperty) {
+                realm::Mixed primaryKey = primaryKeyDefault;
+                if (primaryKeyColumn) {
+                    if (primaryKeyColumn->type == RLMPropertyTypeString) {
+                        primaryKey = primaryKeyColumn->nextString();
+                    }
+                    else {
+                        primaryKey = primaryKeyColumn->get<int64_t>(i);
+                    }
+                }
+                bool created = false;
+                obj = table->create_object_with_primary_key(primaryKey, &created);
+                if (!created) {
+                    @throw RLMException(@"Attempting to create an object of type '%@' with an existing "
+                                        @"primary key value '%@'.", className,
+                                        RLMMixedToObjc(primaryKey));
+                }
+            }
+            else {
+                obj = table->create_object();
+            }
+
+            for (auto& [col, value] : defaults) {
+                obj.set_any(col, value);
+            }
+            for (auto& column : imported) {
+                switch (column.type) {
+                    case RLMPropertyTypeInt:
+                        obj.set(column.col, column.get<int64_t>(i));
+                        break;
+                    case RLMPropertyTypeBool:
+                        obj.set(column.col, column.get<uint8_t>(i) != 0);
+                        break;
+                    case RLMPropertyTypeFloat:
+                        obj.set(column.col, column.get<float>(i));
+                        break;
+                    case RLMPropertyTypeDouble:
+                        obj.set(column.col, column.get<double>(i));
+                        break;
+                    case RLMPropertyTypeDate:
+                        // Columns hold seconds since 1970, which is converted
+                        // the same way as for an NSDate created from it
+                        obj.set(column.col, RLMTimestampForTimeIntervalSinceReferenceDate(
+                            column.get<double>(i) - NSTimeIntervalSince1970));
+                        break;
+                    case RLMPropertyTypeString:
+                        obj.set(column.col, column.nextString());
+                        break;
+                    default:
+                        REALM_UNREACHABLE();
+                }
+            }
+        }
+    }
+    catch (std::exception const& e) {
+        @throw RLMException(e);
+    }
+}
+
 void RLMCreateAsymmetricObjectInRealm(RLMRealm *realm, NSString *className, id value) {
     RLMVerifyInWriteTransaction(realm);
 
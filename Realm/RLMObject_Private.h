@@ -82,6 +82,11 @@ FOUNDATION_EXTERN id RLMObjectFreeze(RLMObjectBase *obj) NS_RETURNS_RETAINED;
 
 FOUNDATION_EXTERN id RLMObjectThaw(RLMObjectBase *obj);
 
+// Freeze or thaw each of the given objects, which must all be managed by
+// `realm`. Thawed objects which have since been deleted are NSNull.
+FOUNDATION_EXTERN NSArray *RLMObjectsFreeze(RLMRealm *realm, NSArray *objects);
+FOUNDATION_EXTERN NSArray *RLMObjectsThaw(RLMRealm *realm, NSArray *objects);
+
 // Gets an object identifier suitable for use with Combine. This value may
 // change when an unmanaged object is added to the Realm.
 FOUNDATION_EXTERN uint64_t RLMObjectBaseGetCombineId(RLMObjectBase *);
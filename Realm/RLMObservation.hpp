@@ -23,8 +23,11 @@
 #import <realm/object-store/impl/deep_change_checker.hpp>
 #import <realm/table.hpp>
 
+#import <unordered_map>
+
 @class RLMObjectBase, RLMRealm, RLMSchema, RLMProperty, RLMObjectSchema;
 class RLMClassInfo;
+class RLMObservedObjects;
 class RLMSchemaInfo;
 
 namespace realm {
@@ -39,8 +42,8 @@ namespace realm {
 // RLMObservationInfo instances, so it could be folded into RLMObjectBase, and
 // is a separate class mostly to avoid making all accessor objects far larger.
 //
-// RLMClassInfo stores a vector of pointers to the first observation info
-// created for each row. If there are multiple observation infos for a single
+// RLMClassInfo stores an ObjKey-indexed set of pointers to the first
+// observation info created for each row. If there are multiple observation infos for a single
 // row (such as if there are multiple observed objects backed by a single row,
 // or if both an object and an array property of that object are observed),
 // they're stored in an intrusive doubly-linked-list in the `next` and `prev`
@@ -138,8 +141,8 @@ private:
 };
 
 // Get the the observation info chain for the given row
-// Will simply return info if it's non-null, and will search ojectSchema's array
-// for a matching one otherwise, and return null if there are none
+// Will simply return info if it's non-null, and will look up the row in
+// objectSchema's observed objects otherwise, and return null if there are none
 RLMObservationInfo *RLMGetObservationInfo(RLMObservationInfo *info, realm::ObjKey row, RLMClassInfo& objectSchema);
 
 // delete all objects from a single table with change notifications
@@ -158,7 +161,8 @@ public:
     void didChange();
 
 private:
-    std::vector<std::vector<RLMObservationInfo *> *> _observedTables;
+    // The observed objects for each table which has any, keyed on table key
+    std::unordered_map<uint32_t, RLMObservedObjects *> _observedTables;
     __unsafe_unretained RLMRealm const*_realm;
     realm::Group& _group;
     RLMObservationInfo *_info = nullptr;
@@ -175,6 +179,23 @@ private:
     std::vector<Change> _changes;
     std::vector<RLMObservationInfo *> _invalidated;
 
+    // Index into _changes for the list properties which have had links removed
+    // so that multiple removals from the same list are merged into one change
+    struct ChangeKey {
+        RLMObservationInfo *info;
+        __unsafe_unretained NSString *property;
+        bool operator==(ChangeKey const& other) const noexcept {
+            return info == other.info && property == other.property;
+        }
+    };
+    struct ChangeKeyHash {
+        size_t operator()(ChangeKey const& key) const noexcept {
+            auto h = std::hash<void *>()(key.info);
+            return h ^ (std::hash<void *>()((__bridge void *)key.property) + 0x9e3779b9 + (h << 6) + (h >> 2));
+        }
+    };
+    std::unordered_map<ChangeKey, size_t, ChangeKeyHash> _listChanges;
+
     template<typename CascadeNotification>
     void cascadeNotification(CascadeNotification const&);
 };
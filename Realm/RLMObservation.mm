@@ -78,20 +78,15 @@ RLMObservationInfo::~RLMObservationInfo() {
         }
     }
     else if (objectSchema) {
-        // The head of the list, so remove self from the object schema's array
+        // The head of the list, so remove self from the object schema's set
         // of observation info, either replacing self with the next info or
         // removing entirely if there is no next
-        auto end = objectSchema->observedObjects.end();
-        auto it = find(objectSchema->observedObjects.begin(), end, this);
-        if (it != end) {
-            if (next) {
-                *it = next;
-                next->prev = nullptr;
-            }
-            else {
-                iter_swap(it, std::prev(end));
-                objectSchema->observedObjects.pop_back();
-            }
+        if (next) {
+            objectSchema->observedObjects.replace(row.get_key(), this, next);
+            next->prev = nullptr;
+        }
+        else {
+            objectSchema->observedObjects.erase(row.get_key(), this);
         }
     }
     // Otherwise the observed object was unmanaged, so nothing to do
@@ -145,17 +140,15 @@ void RLMObservationInfo::setRow(realm::Table const& table, realm::ObjKey key) {
     REALM_ASSERT_DEBUG(!row);
     REALM_ASSERT_DEBUG(objectSchema);
     row = table.get_object(key);
-    for (auto info : objectSchema->observedObjects) {
-        if (info->row && info->row.get_key() == key) {
-            prev = info;
-            next = info->next;
-            if (next)
-                next->prev = this;
-            info->next = this;
-            return;
-        }
+    if (auto info = objectSchema->observedObjects.find(key); info && info->row) {
+        prev = info;
+        next = info->next;
+        if (next)
+            next->prev = this;
+        info->next = this;
+        return;
     }
-    objectSchema->observedObjects.push_back(this);
+    objectSchema->observedObjects.insert(key, this);
 }
 
 void RLMObservationInfo::recordObserver(realm::Obj& objectRow, RLMClassInfo *objectInfo,
@@ -263,13 +256,7 @@ RLMObservationInfo *RLMGetObservationInfo(RLMObservationInfo *info, realm::ObjKe
         return info;
     }
 
-    for (RLMObservationInfo *info : objectSchema.observedObjects) {
-        if (info->isForRow(row)) {
-            return info;
-        }
-    }
-
-    return nullptr;
+    return objectSchema.observedObjects.find(row);
 }
 
 void RLMClearTable(RLMClassInfo &objectSchema) {
@@ -331,8 +318,9 @@ void RLMObservationTracker::trackDeletions() {
     }
 
     for (auto& info : _realm->_info) {
-        if (!info.second.observedObjects.empty()) {
-            _observedTables.push_back(&info.second.observedObjects);
+        auto& observed = info.second.observedObjects;
+        if (!observed.empty()) {
+            _observedTables[observed.front()->getRow().get_table()->get_key().value] = &observed;
         }
     }
 
@@ -355,81 +343,69 @@ void RLMObservationTracker::cascadeNotification(CascadeNotification const& cs) {
     size_t invalidatedCount = _invalidated.size();
     size_t changeCount = _changes.size();
 
-    auto tableKey = [](RLMObservationInfo *info) {
-        return info->getRow().get_table()->get_key();
+    auto observedObjects = [&](realm::TableKey key) -> RLMObservedObjects * {
+        auto it = _observedTables.find(key.value);
+        return it == _observedTables.end() ? nullptr : it->second;
     };
-    std::sort(begin(_observedTables), end(_observedTables),
-              [=](auto a, auto b) { return tableKey(a->front()) < tableKey(b->front()); });
+
     for (auto const& link : cs.links) {
-        auto table = std::find_if(_observedTables.begin(), _observedTables.end(), [&](auto table) {
-            return tableKey(table->front()) == link.origin_table;
-        });
-        if (table == _observedTables.end()) {
+        auto table = observedObjects(link.origin_table);
+        if (!table) {
+            continue;
+        }
+        auto observer = table->find(link.origin_key);
+        if (!observer) {
             continue;
         }
 
-        for (auto observer : **table) {
-            if (!observer->isForRow(link.origin_key)) {
-                continue;
-            }
-
-            NSString *name = observer->columnName(link.origin_col_key);
-            if (!link.origin_col_key.is_list()) {
-                _changes.push_back({observer, name});
-                continue;
-            }
-
-            auto c = find_if(begin(_changes), end(_changes), [&](auto const& c) {
-                return c.info == observer && c.property == name;
-            });
-            if (c == end(_changes)) {
-                _changes.push_back({observer, name, [NSMutableIndexSet new]});
-                c = prev(end(_changes));
-            }
+        NSString *name = observer->columnName(link.origin_col_key);
+        if (!link.origin_col_key.is_list()) {
+            _changes.push_back({observer, name});
+            continue;
+        }
 
-            // We know what row index is being removed from the LinkView,
-            // but what we actually want is the indexes in the LinkView that
-            // are going away
-            auto linkview = observer->getRow().get_linklist(link.origin_col_key);
-            linkview.find_all(link.old_target_key, [&](size_t index) {
-                [c->indexes addIndex:index];
-            });
+        auto [it, inserted] = _listChanges.try_emplace({observer, name}, _changes.size());
+        if (inserted) {
+            _changes.push_back({observer, name, [NSMutableIndexSet new]});
         }
+        auto& change = _changes[it->second];
+
+        // We know what row index is being removed from the LinkView,
+        // but what we actually want is the indexes in the LinkView that
+        // are going away
+        auto linkview = observer->getRow().get_linklist(link.origin_col_key);
+        linkview.find_all(link.old_target_key, [&](size_t index) {
+            [change.indexes addIndex:index];
+        });
     }
-    if (!cs.rows.empty()) {
-        using Row = realm::Group::CascadeNotification::row;
-        auto begin = cs.rows.begin();
-        for (auto table : _observedTables) {
-            auto currentTableKey = tableKey(table->front());
-            if (begin->table_key < currentTableKey) {
-                // Find the first deleted object in or after this table
-                begin = std::lower_bound(begin, cs.rows.end(), Row{currentTableKey, realm::ObjKey(0)});
-            }
-            if (begin == cs.rows.end()) {
-                // No more deleted objects
-                break;
-            }
-            if (currentTableKey < begin->table_key) {
-                // Next deleted object is in a table after this one
-                continue;
-            }
-
-            // Find the end of the deletions in this table
-            auto end = std::lower_bound(begin, cs.rows.end(), Row{realm::TableKey(currentTableKey.value + 1), realm::ObjKey(0)});
 
-            // Check each observed object to see if it's in the deleted rows
-            for (auto info : *table) {
-                if (std::binary_search(begin, end, Row{currentTableKey, info->getRow().get_key()})) {
-                    _invalidated.push_back(info);
+    // cs.rows is sorted by table and then by object key, so process it one
+    // table at a time. For each table either look up each deleted row in the
+    // observed objects or check each observed object against the deleted
+    // rows, whichever has fewer things to check.
+    using Row = realm::Group::CascadeNotification::row;
+    for (auto begin = cs.rows.begin(); begin != cs.rows.end(); ) {
+        auto currentTableKey = begin->table_key;
+        auto end = std::upper_bound(begin, cs.rows.end(), Row{currentTableKey, realm::ObjKey(std::numeric_limits<int64_t>::max())});
+
+        if (auto table = observedObjects(currentTableKey)) {
+            if (size_t(end - begin) <= table->size()) {
+                for (auto it = begin; it != end; ++it) {
+                    if (auto info = table->find(it->key)) {
+                        _invalidated.push_back(info);
+                    }
                 }
             }
-
-            // Advance the begin iterator to the start of the next table
-            begin = end;
-            if (begin == cs.rows.end()) {
-                break;
+            else {
+                for (auto info : *table) {
+                    if (std::binary_search(begin, end, Row{currentTableKey, info->getRow().get_key()})) {
+                        _invalidated.push_back(info);
+                    }
+                }
             }
         }
+
+        begin = end;
     }
 
     // The relative order of these loops is very important
@@ -463,6 +439,7 @@ void RLMObservationTracker::didChange() {
     }
     _observedTables.clear();
     _changes.clear();
+    _listChanges.clear();
     _invalidated.clear();
 }
 
@@ -18,6 +18,7 @@
 
 #import <Foundation/Foundation.h>
 
+#import <memory>
 #import <vector>
 
 namespace realm {
@@ -29,6 +30,20 @@ namespace realm {
 @class RLMObjectSchema, RLMProperty, RLMSchema, RLMSortDescriptor;
 class RLMClassInfo;
 
+// A cache of the key paths in predicates which have been resolved to the
+// properties they refer to. Each RLMSchema owns one, so cached key paths are
+// discarded along with the schema they were resolved against.
+class RLMKeyPathCache;
+std::shared_ptr<RLMKeyPathCache> RLMMakeKeyPathCache();
+void RLMClearKeyPathCache(RLMKeyPathCache& cache);
+
+struct RLMKeyPathCacheStats {
+    uint64_t hits;
+    uint64_t misses;
+    size_t size;
+};
+RLMKeyPathCacheStats RLMGetKeyPathCacheStats(RLMKeyPathCache& cache);
+
 realm::Query RLMPredicateToQuery(NSPredicate *predicate, RLMObjectSchema *objectSchema,
                                  RLMSchema *schema, realm::Group &group);
 
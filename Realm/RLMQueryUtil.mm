@@ -24,7 +24,7 @@
 #import "RLMObject_Private.hpp"
 #import "RLMPredicateUtil.hpp"
 #import "RLMProperty_Private.h"
-#import "RLMSchema.h"
+#import "RLMSchema_Private.hpp"
 #import "RLMUtil.hpp"
 
 #import <realm/geospatial.hpp>
@@ -36,6 +36,9 @@
 #import <realm/util/cf_ptr.hpp>
 #import <realm/util/overload.hpp>
 
+#import <mutex>
+#import <unordered_map>
+
 using namespace realm;
 
 namespace {
@@ -1255,7 +1258,7 @@ struct KeyPath {
     bool containsToManyRelationship;
 };
 
-KeyPath key_path_from_string(RLMSchema *schema, RLMObjectSchema *objectSchema, NSString *keyPath)
+KeyPath resolve_key_path(RLMSchema *schema, RLMObjectSchema *objectSchema, NSString *keyPath)
 {
     RLMProperty *property;
     std::vector<RLMProperty *> links;
@@ -1345,6 +1348,94 @@ KeyPath key_path_from_string(RLMSchema *schema, RLMObjectSchema *objectSchema, N
     links.pop_back();
     return {std::move(links), property, collectionOperation, keyPathContainsToManyRelationship};
 }
+} // namespace
+
+class RLMKeyPathCache {
+public:
+    std::optional<KeyPath> find(RLMObjectSchema *objectSchema, NSString *keyPath) {
+        std::lock_guard lock(m_mutex);
+        auto it = m_key_paths.find({objectSchema, keyPath});
+        if (it == m_key_paths.end()) {
+            ++m_misses;
+            return std::nullopt;
+        }
+        ++m_hits;
+        return it->second;
+    }
+
+    void insert(RLMObjectSchema *objectSchema, NSString *keyPath, KeyPath const& resolved) {
+        std::lock_guard lock(m_mutex);
+        // Key paths are usually drawn from a small fixed set of query strings,
+        // so rather than tracking usage just start over if something is
+        // generating an unbounded number of them
+        if (m_key_paths.size() >= max_size) {
+            m_key_paths.clear();
+        }
+        m_key_paths.emplace(Key{objectSchema, [keyPath copy]}, resolved);
+    }
+
+    void clear() {
+        std::lock_guard lock(m_mutex);
+        m_key_paths.clear();
+    }
+
+    RLMKeyPathCacheStats stats() {
+        std::lock_guard lock(m_mutex);
+        return {m_hits, m_misses, m_key_paths.size()};
+    }
+
+private:
+    static constexpr size_t max_size = 1000;
+
+    struct Key {
+        RLMObjectSchema *objectSchema;
+        NSString *keyPath;
+
+        bool operator==(Key const& other) const {
+            return objectSchema == other.objectSchema && [keyPath isEqualToString:other.keyPath];
+        }
+    };
+    struct KeyHash {
+        size_t operator()(Key const& key) const {
+            return std::hash<void *>()((__bridge void *)key.objectSchema) ^ key.keyPath.hash;
+        }
+    };
+
+    std::mutex m_mutex;
+    std::unordered_map<Key, KeyPath, KeyHash> m_key_paths;
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+};
+
+std::shared_ptr<RLMKeyPathCache> RLMMakeKeyPathCache() {
+    return std::make_shared<RLMKeyPathCache>();
+}
+
+void RLMClearKeyPathCache(RLMKeyPathCache& cache) {
+    cache.clear();
+}
+
+RLMKeyPathCacheStats RLMGetKeyPathCacheStats(RLMKeyPathCache& cache) {
+    return cache.stats();
+}
+
+namespace {
+// Resolving a key path involves splitting it into components and looking up
+// and validating each property along the way, so cache the result for
+// predicates which are built repeatedly with different values
+KeyPath key_path_from_string(RLMSchema *schema, RLMObjectSchema *objectSchema, NSString *keyPath)
+{
+    if (!schema) {
+        return resolve_key_path(schema, objectSchema, keyPath);
+    }
+    auto& cache = [schema keyPathCache];
+    if (auto cached = cache.find(objectSchema, keyPath)) {
+        return std::move(*cached);
+    }
+    auto resolved = resolve_key_path(schema, objectSchema, keyPath);
+    cache.insert(objectSchema, keyPath, resolved);
+    return resolved;
+}
 
 ColumnReference QueryBuilder::column_reference_from_key_path(KeyPath&& kp, bool isAggregate)
 {
@@ -18,7 +18,7 @@
 
 #import <Realm/RLMConstants.h>
 
-@class RLMRealmConfiguration, RLMRealm, RLMObject, RLMSchema, RLMMigration, RLMNotificationToken, RLMThreadSafeReference, RLMAsyncOpenTask, RLMSyncSubscriptionSet;
+@class RLMRealmConfiguration, RLMRealm, RLMObject, RLMSchema, RLMMigration, RLMNotificationToken, RLMThreadSafeReference, RLMAsyncOpenTask, RLMSyncSubscriptionSet, RLMFrozenRealmCacheStatistics, RLMFrozenRealmPin;
 
 /**
  A callback block for opening Realms asynchronously.
@@ -220,6 +220,76 @@ RLM_HEADER_AUDIT_BEGIN(nullability, sendability)
  */
 - (RLMRealm *)thaw;
 
+/**
+ Returns frozen snapshots of each of the given objects.
+
+ This is equivalent to calling `-freeze` on each of the objects, but is
+ significantly faster for large numbers of objects as the frozen Realm and the
+ information about each object type are looked up once for the whole array.
+
+ If this Realm is already frozen the objects are returned unchanged.
+
+ @param objects An array of `RLMObject`s or `RLMEmbeddedObject`s managed by
+                this Realm.
+ @return An array of the frozen objects, in the same order.
+ */
+- (NSArray *)freezeObjects:(NSArray *)objects;
+
+/**
+ Returns live references to each of the given frozen objects.
+
+ This is equivalent to calling `-thaw` on each of the objects, but is
+ significantly faster for large numbers of objects as the live Realm and the
+ information about each object type are looked up once for the whole array.
+
+ If this Realm is not frozen the objects are returned unchanged.
+
+ @param objects An array of `RLMObject`s or `RLMEmbeddedObject`s managed by
+                this frozen Realm.
+ @return An array of the live objects, in the same order. Objects which have
+         been deleted since the frozen version are `NSNull`.
+ */
+- (NSArray *)thawObjects:(NSArray *)objects;
+
+/**
+ The number of recently frozen versions of each Realm file which
+ `-[RLMRealm freeze]` keeps alive.
+
+ The cache holds a strong reference to the frozen Realms for the most recently
+ frozen versions, so that calling `-freeze` again at one of those versions
+ returns the same frozen Realm even if all other references to it have been
+ released. When this limit is exceeded, the cache releases its reference to the
+ least recently frozen version which is not explicitly pinned. The evicted
+ version is still reused by `-freeze` while something else references it, and
+ is released once the last reference to it is released.
+
+ This only bounds the versions kept alive by the cache itself. Each frozen
+ Realm which is still referenced elsewhere keeps its version of the data in the
+ file, so holding on to a frozen Realm for every write still makes the file grow.
+
+ Defaults to 0, which means that the cache does not keep frozen Realms alive and
+ they are released as soon as they are no longer referenced.
+ */
+@property (class, nonatomic) NSUInteger maximumFrozenVersions;
+
+/**
+ Statistics about the frozen versions of this Realm's file which are
+ currently cached.
+ */
+@property (nonatomic, readonly) RLMFrozenRealmCacheStatistics *frozenRealmCacheStatistics;
+
+/**
+ Freezes this Realm and keeps the resulting version cached until the returned
+ pin is released.
+
+ Subsequent calls to `-freeze` on any Realm for this file at the same version
+ return the pinned frozen Realm, even if all other references to it have
+ been released, and the version is never evicted due to
+ `maximumFrozenVersions`. The pin is released by calling `-unpin` on it or
+ when it is deallocated.
+ */
+- (RLMFrozenRealmPin *)pinFrozenSnapshot;
+
 #pragma mark - File Management
 
 /**
@@ -959,4 +1029,41 @@ RLM_SWIFT_SENDABLE // is internally thread-safe
 - (void)stop __attribute__((unavailable("Renamed to -invalidate."))) NS_REFINED_FOR_SWIFT;
 @end
 
+// MARK: - Frozen Realm cache
+
+/// Statistics about the frozen versions of a Realm file cached by `-[RLMRealm freeze]`.
+RLM_SWIFT_SENDABLE RLM_FINAL // immutable
+@interface RLMFrozenRealmCacheStatistics : NSObject
+/// The number of distinct versions which are currently frozen.
+@property (nonatomic, readonly) NSUInteger frozenVersions;
+/// The number of frozen versions which are explicitly pinned.
+@property (nonatomic, readonly) NSUInteger pinnedVersions;
+/// The number of bytes in the file which are only in use by versions older
+/// than the latest one, and so cannot be reused until they are released.
+@property (nonatomic, readonly) uint64_t bytesRetainedByOldVersions;
+/// The number of calls to `-freeze` which returned an already frozen Realm.
+@property (nonatomic, readonly) NSUInteger hits;
+/// The number of calls to `-freeze` which had to freeze a new Realm.
+@property (nonatomic, readonly) NSUInteger misses;
+/// The number of versions whose cached reference has been released due to
+/// `maximumFrozenVersions`.
+@property (nonatomic, readonly) NSUInteger evictions;
+/// The fraction of calls to `-freeze` which returned an already frozen Realm,
+/// or 0 if `-freeze` has not been called.
+@property (nonatomic, readonly) double hitRate;
+@end
+
+/**
+ A frozen Realm which is kept cached until the pin is released.
+
+ @see `-[RLMRealm pinFrozenSnapshot]`
+ */
+RLM_SWIFT_SENDABLE RLM_FINAL // is internally thread-safe
+@interface RLMFrozenRealmPin : NSObject
+/// The pinned frozen Realm.
+@property (nonatomic, readonly) RLMRealm *realm;
+/// Releases the pin. Does nothing if the pin was already released.
+- (void)unpin;
+@end
+
 RLM_HEADER_AUDIT_END(nullability, sendability)
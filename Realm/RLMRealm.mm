@@ -44,6 +44,7 @@
 #import "RLMUpdateChecker.hpp"
 #import "RLMUtil.hpp"
 
+#import <realm/db.hpp>
 #import <realm/disable_sync_to_disk.hpp>
 #import <realm/object-store/impl/realm_coordinator.hpp>
 #import <realm/object-store/object_store.hpp>
@@ -53,6 +54,8 @@
 #import <realm/util/scope_exit.hpp>
 #import <realm/version.hpp>
 
+#import <unordered_map>
+
 #if REALM_ENABLE_SYNC
 #import "RLMSyncManager_Private.hpp"
 #import "RLMSyncSession_Private.hpp"
@@ -236,6 +239,66 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
 }
 } // anonymous namespace
 
+@interface RLMFrozenRealmCacheStatistics ()
+- (instancetype)initWithCounts:(RLMFrozenRealmCacheCounts const&)counts bytesRetained:(uint64_t)bytesRetained;
+@end
+
+@interface RLMFrozenRealmPin ()
+- (instancetype)initWithRealm:(RLMRealm *)realm alreadyPinned:(bool)alreadyPinned;
+@end
+
+@implementation RLMFrozenRealmCacheStatistics
+- (instancetype)initWithCounts:(RLMFrozenRealmCacheCounts const&)counts bytesRetained:(uint64_t)bytesRetained {
+    if ((self = [super init])) {
+        _frozenVersions = counts.versions;
+        _pinnedVersions = counts.pinnedVersions;
+        _bytesRetainedByOldVersions = bytesRetained;
+        _hits = static_cast<NSUInteger>(counts.hits);
+        _misses = static_cast<NSUInteger>(counts.misses);
+        _evictions = static_cast<NSUInteger>(counts.evictions);
+    }
+    return self;
+}
+
+- (double)hitRate {
+    NSUInteger total = _hits + _misses;
+    return total ? static_cast<double>(_hits) / total : 0;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"RLMFrozenRealmCacheStatistics {\n\tfrozenVersions: %lu\n\tpinnedVersions: %lu\n\tbytesRetainedByOldVersions: %llu\n\thitRate: %.3f (%lu hits, %lu misses)\n\tevictions: %lu\n}",
+            (unsigned long)_frozenVersions, (unsigned long)_pinnedVersions,
+            (unsigned long long)_bytesRetainedByOldVersions, self.hitRate,
+            (unsigned long)_hits, (unsigned long)_misses, (unsigned long)_evictions];
+}
+@end
+
+@implementation RLMFrozenRealmPin {
+    std::atomic<bool> _pinned;
+}
+
+- (instancetype)initWithRealm:(RLMRealm *)realm alreadyPinned:(bool)alreadyPinned {
+    if ((self = [super init])) {
+        _realm = realm;
+        _pinned = true;
+        if (!alreadyPinned) {
+            RLMPinFrozenRealm(realm);
+        }
+    }
+    return self;
+}
+
+- (void)unpin {
+    if (_pinned.exchange(false)) {
+        RLMUnpinFrozenRealm(_realm);
+    }
+}
+
+- (void)dealloc {
+    [self unpin];
+}
+@end
+
 @implementation RLMRealm {
     std::mutex _collectionEnumeratorMutex;
     NSHashTable<RLMFastEnumerator *> *_collectionEnumerators;
@@ -249,11 +312,11 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
 }
 
 + (void)runFirstCheckForConfiguration:(RLMRealmConfiguration *)configuration schema:(RLMSchema *)schema {
-    static bool initialized;
-    if (initialized) {
+    // Realms for different files can be opened concurrently
+    static std::atomic<bool> initialized;
+    if (initialized.load(std::memory_order_relaxed) || initialized.exchange(true)) {
         return;
     }
-    initialized = true;
 
     // Run Analytics on the very first any Realm open.
     RLMSendAnalytics(configuration, schema);
@@ -383,6 +446,51 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
     return realm;
 }
 
+namespace {
+// Opening a Realm file has to be serialized with other opens of the same file
+// so that only one of them initializes the schema and the others can reuse
+// it, but opens of unrelated files share nothing and can run in parallel. A
+// lock is created for each path while it's being opened and discarded when
+// the last opener is done with it.
+class RealmOpenLock {
+public:
+    RealmOpenLock(std::string const& path) {
+        {
+            std::lock_guard lock(s_mutex);
+            auto [it, inserted] = s_locks.try_emplace(path);
+            _entry = &*it;
+            ++_entry->second.users;
+        }
+        _entry->second.mutex.lock();
+    }
+
+    ~RealmOpenLock() {
+        _entry->second.mutex.unlock();
+        std::lock_guard lock(s_mutex);
+        if (--_entry->second.users == 0) {
+            s_locks.erase(_entry->first);
+        }
+    }
+
+private:
+    struct Entry {
+        RLMUnfairMutex mutex;
+        size_t users = 0;
+    };
+    // Elements of unordered_map are never moved, so pointers to them remain
+    // valid until they are erased
+    static RLMUnfairMutex& s_mutex;
+    static std::unordered_map<std::string, Entry>& s_locks;
+    std::pair<const std::string, Entry> *_entry;
+
+    RealmOpenLock(RealmOpenLock const&) = delete;
+    RealmOpenLock& operator=(RealmOpenLock const&) = delete;
+};
+
+RLMUnfairMutex& RealmOpenLock::s_mutex = *new RLMUnfairMutex;
+std::unordered_map<std::string, RealmOpenLock::Entry>& RealmOpenLock::s_locks = *new std::unordered_map<std::string, Entry>;
+} // anonymous namespace
+
 + (instancetype)realmWithConfiguration:(RLMRealmConfiguration *)configuration error:(NSError **)error {
     return autorelease([self realmWithConfiguration:configuration
                                          confinedTo:RLMScheduler.currentRunLoop
@@ -418,9 +526,8 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
     realm->_dynamic = dynamic;
     realm->_actor = scheduler.actor;
 
-    // protects the realm cache and accessors cache
-    static auto& initLock = *new RLMUnfairMutex;
-    std::lock_guard lock(initLock);
+    // Serializes opening this file so that the schema is only initialized once
+    RealmOpenLock lock(config.path);
 
     try {
         config.scheduler = scheduler.osScheduler;
@@ -874,13 +981,7 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
 }
 
 - (void)addObjects:(id<NSFastEnumeration>)objects {
-    for (RLMObject *obj in objects) {
-        if (![obj isKindOfClass:RLMObjectBase.class]) {
-            @throw RLMException(@"Cannot insert objects of type %@ with addObjects:. Only RLMObjects are supported.",
-                                NSStringFromClass(obj.class));
-        }
-        [self addObject:obj];
-    }
+    RLMAddObjectsToRealm(objects, self, RLMUpdatePolicyError);
 }
 
 - (void)addOrUpdateObject:(RLMObject *)object {
@@ -893,14 +994,7 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
 }
 
 - (void)addOrUpdateObjects:(id<NSFastEnumeration>)objects {
-    for (RLMObject *obj in objects) {
-        if (![obj isKindOfClass:RLMObjectBase.class]) {
-            @throw RLMException(@"Cannot add or update objects of type %@ with addOrUpdateObjects:. Only RLMObjects are"
-                                " supported.",
-                                NSStringFromClass(obj.class));
-        }
-        [self addOrUpdateObject:obj];
-    }
+    RLMAddObjectsToRealm(objects, self, RLMUpdatePolicyUpdateAll);
 }
 
 - (void)deleteObject:(RLMObject *)object {
@@ -1021,6 +1115,25 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
     return (RLMObject *)RLMCreateObjectInRealmWithValue(self, className, value, RLMUpdatePolicyError);
 }
 
+- (NSArray<RLMObject *> *)createObjects:(NSString *)className withValues:(id<NSFastEnumeration>)values {
+    return (NSArray *)RLMCreateObjectsInRealmWithValues(self, className, values, RLMUpdatePolicyError,
+                                                        true, 0, nil);
+}
+
+- (void)createObjects:(NSString *)className
+           withValues:(id<NSFastEnumeration>)values
+            batchSize:(NSUInteger)batchSize
+             progress:(void (^)(NSUInteger))progress {
+    RLMCreateObjectsInRealmWithValues(self, className, values, RLMUpdatePolicyError,
+                                      false, batchSize, progress);
+}
+
+- (void)createObjects:(NSString *)className
+                count:(NSUInteger)count
+          withColumns:(NSDictionary<NSString *, NSData *> *)columns {
+    RLMCreateObjectsInRealmWithColumns(self, className, count, columns);
+}
+
 - (BOOL)writeCopyToURL:(NSURL *)fileURL encryptionKey:(NSData *)key error:(NSError **)error {
     RLMRealmConfiguration *configuration = [RLMRealmConfiguration new];
     configuration.fileURL = fileURL;
@@ -1085,6 +1198,49 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
     return self.isFrozen ? [RLMRealm realmWithConfiguration:self.configurationSharingSchema error:nil] : self;
 }
 
+- (NSArray *)freezeObjects:(NSArray *)objects {
+    [self verifyThread];
+    return RLMObjectsFreeze(self, objects);
+}
+
+- (NSArray *)thawObjects:(NSArray *)objects {
+    [self verifyThread];
+    return RLMObjectsThaw(self, objects);
+}
+
++ (NSUInteger)maximumFrozenVersions {
+    return RLMGetMaximumFrozenVersions();
+}
+
++ (void)setMaximumFrozenVersions:(NSUInteger)maximumFrozenVersions {
+    RLMSetMaximumFrozenVersions(maximumFrozenVersions);
+}
+
+- (RLMFrozenRealmCacheStatistics *)frozenRealmCacheStatistics {
+    [self verifyThread];
+    auto counts = RLMGetFrozenRealmCacheCounts(_realm->config().path);
+    size_t freeSpace = 0, usedSpace = 0, lockedSpace = 0;
+    try {
+        auto& transaction = static_cast<realm::Transaction&>(_realm->read_group());
+        transaction.get_db()->get_stats(freeSpace, usedSpace, &lockedSpace);
+    }
+    catch (std::exception const& e) {
+        @throw RLMException(e);
+    }
+    return [[RLMFrozenRealmCacheStatistics alloc] initWithCounts:counts bytesRetained:lockedSpace];
+}
+
+- (RLMFrozenRealmPin *)pinFrozenSnapshot {
+    [self verifyThread];
+    if (self.isFrozen) {
+        return [[RLMFrozenRealmPin alloc] initWithRealm:self alreadyPinned:false];
+    }
+    // Pinned while looking up the frozen Realm so that the version can't be
+    // evicted between freezing and pinning it
+    return [[RLMFrozenRealmPin alloc] initWithRealm:RLMGetFrozenRealmForSourceRealm(self, true)
+                                      alreadyPinned:true];
+}
+
 - (RLMRealm *)frozenCopy {
     try {
         RLMRealm *realm = [[RLMRealm alloc] initPrivate];
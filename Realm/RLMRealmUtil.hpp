@@ -35,6 +35,29 @@ RLMRealm *RLMGetAnyCachedRealmForPath(std::string const& path) NS_RETURNS_RETAIN
 // Clear the weak cache of Realms
 void RLMClearRealmCache();
 
-RLMRealm *RLMGetFrozenRealmForSourceRealm(RLMRealm *realm) NS_RETURNS_RETAINED;
+// Get the cached frozen Realm for the source Realm's current version, freezing
+// it if needed. If `pin` is true the version is also pinned as if by
+// RLMPinFrozenRealm() while the cache is locked, so that it can't be evicted
+// before the pin is taken.
+RLMRealm *RLMGetFrozenRealmForSourceRealm(RLMRealm *realm, bool pin = false) NS_RETURNS_RETAINED;
+
+// Limit the number of distinct versions of each file which are kept frozen,
+// evicting the least recently used beyond that. 0 means unlimited.
+void RLMSetMaximumFrozenVersions(size_t maximum);
+size_t RLMGetMaximumFrozenVersions();
+
+struct RLMFrozenRealmCacheCounts {
+    size_t versions;
+    size_t pinnedVersions;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+};
+RLMFrozenRealmCacheCounts RLMGetFrozenRealmCacheCounts(std::string const& path);
+
+// Keep the frozen Realm's version cached and exempt from eviction until a
+// matching call to RLMUnpinFrozenRealm()
+void RLMPinFrozenRealm(RLMRealm *frozenRealm);
+void RLMUnpinFrozenRealm(RLMRealm *frozenRealm);
 
 std::unique_ptr<realm::BindingContext> RLMCreateBindingContext(RLMRealm *realm);
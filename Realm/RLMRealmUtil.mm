@@ -30,33 +30,138 @@
 #import <realm/object-store/shared_realm.hpp>
 #import <realm/object-store/util/scheduler.hpp>
 
+#import <algorithm>
+#import <array>
 #import <map>
+#import <unordered_map>
+#import <vector>
 
-// Global realm state
-static auto& s_realmCacheMutex = *new RLMUnfairMutex;
-static auto& s_realmsPerPath = *new std::map<std::string, NSMapTable *>();
-static auto& s_frozenRealms = *new std::map<std::string, NSMapTable *>();
+namespace {
+// Live Realms are cached per (path, scheduler). The cache is split into shards
+// by scheduler so that threads and queues opening Realms concurrently take
+// different locks even when they open the same file, and a shard's lock is
+// normally only ever taken by the one thread using that scheduler. Within a
+// shard Realms are grouped by scheduler and then by path, so a lookup is a
+// single pointer hash followed by a scan over the (usually very few) paths
+// opened on that scheduler, and never copies the path.
+struct CachedRealm {
+    std::string path;
+    __weak RLMRealm *realm;
+};
+
+struct RealmCacheShard {
+    RLMUnfairMutex mutex;
+    std::unordered_map<void *, std::vector<CachedRealm>> realms;
+    // Schedulers with no live Realms are pruned when the shard grows past this
+    // number of schedulers
+    size_t pruneThreshold = 16;
+};
+
+constexpr size_t s_realmCacheShardBits = 4;
+static auto& s_realmCacheShards = *new std::array<RealmCacheShard, 1 << s_realmCacheShardBits>();
+
+RealmCacheShard& shardForCacheKey(void *key) {
+    // Cache keys are thread and queue pointers which are all heavily aligned,
+    // so use the high bits of a multiplicative hash rather than the low bits
+    auto hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key)) * 0x9E3779B97F4A7C15ULL;
+    return s_realmCacheShards[hash >> (64 - s_realmCacheShardBits)];
+}
+
+void pruneDeadRealms(RealmCacheShard& shard) {
+    std::erase_if(shard.realms, [](auto& pair) {
+        std::erase_if(pair.second, [](auto& cached) { return !cached.realm; });
+        return pair.second.empty();
+    });
+    shard.pruneThreshold = std::max<size_t>(16, shard.realms.size() * 2);
+}
+} // anonymous namespace
+
+// Frozen Realms are cached per (path, version) and are only looked up when
+// freezing, so they don't need the sharding used for live Realms. Each file
+// normally only has a few versions frozen at once, so the versions are kept
+// in a vector which is scanned linearly.
+namespace {
+struct FrozenRealmEntry {
+    uint64_t version;
+    __weak RLMRealm *realm;
+    // Strong reference held by the cache while this is one of the
+    // s_maximumFrozenVersions most recently frozen versions. Evicting the
+    // version clears this, but the weak reference is kept so that freezing at
+    // that version again reuses the Realm for as long as it's still alive.
+    RLMRealm *retained;
+    // Number of live RLMFrozenRealmPins for this version, each of which holds
+    // a strong reference to the Realm. Pinned versions are never evicted.
+    size_t pinCount;
+    // Value of s_frozenRealmClock when this version was last frozen
+    uint64_t lastUsed;
+};
+
+struct FrozenRealmsForPath {
+    std::vector<FrozenRealmEntry> entries;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+
+    void pruneDeadEntries() {
+        std::erase_if(entries, [](auto& entry) { return !entry.realm; });
+    }
+
+    FrozenRealmEntry *find(uint64_t version) {
+        auto it = std::find_if(entries.begin(), entries.end(),
+                               [&](auto& entry) { return entry.version == version; });
+        return it == entries.end() ? nullptr : &*it;
+    }
+};
+} // anonymous namespace
+
+static auto& s_frozenRealmsMutex = *new RLMUnfairMutex;
+static auto& s_frozenRealms = *new std::map<std::string, FrozenRealmsForPath>();
+static uint64_t s_frozenRealmClock = 0;
+static size_t s_maximumFrozenVersions = 0;
 
 void RLMCacheRealm(__unsafe_unretained RLMRealmConfiguration *const configuration,
                    RLMScheduler *scheduler,
                    __unsafe_unretained RLMRealm *const realm) {
     auto& path = configuration.path;
     auto key = scheduler.cacheKey;
-    std::lock_guard lock(s_realmCacheMutex);
-    NSMapTable *realms = s_realmsPerPath[path];
-    if (!realms) {
-        s_realmsPerPath[path] = realms = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsOpaquePersonality|NSPointerFunctionsOpaqueMemory
-                                                               valueOptions:NSPointerFunctionsWeakMemory];
+    auto& shard = shardForCacheKey(key);
+    std::lock_guard lock(shard.mutex);
+    auto& realms = shard.realms[key];
+    for (auto& cached : realms) {
+        if (cached.path == path) {
+            cached.realm = realm;
+            return;
+        }
+    }
+    // Long-lived schedulers such as the main thread never have their entry
+    // removed by pruneDeadRealms(), so drop any dead Realms for this scheduler
+    // each time a new path is added to it
+    std::erase_if(realms, [](auto& cached) { return !cached.realm; });
+    realms.push_back({path, realm});
+    if (shard.realms.size() > shard.pruneThreshold) {
+        pruneDeadRealms(shard);
     }
-    [realms setObject:realm forKey:(__bridge id)key];
 }
 
 RLMRealm *RLMGetCachedRealm(__unsafe_unretained RLMRealmConfiguration *const configuration,
                             RLMScheduler *scheduler) {
     auto key = scheduler.cacheKey;
     auto& path = configuration.path;
-    std::lock_guard lock(s_realmCacheMutex);
-    RLMRealm *realm = [s_realmsPerPath[path] objectForKey:(__bridge id)key];
+    RLMRealm *realm = nil;
+    {
+        auto& shard = shardForCacheKey(key);
+        std::lock_guard lock(shard.mutex);
+        auto it = shard.realms.find(key);
+        if (it == shard.realms.end()) {
+            return nil;
+        }
+        for (auto& cached : it->second) {
+            if (cached.path == path) {
+                realm = cached.realm;
+                break;
+            }
+        }
+    }
     if (realm && !realm->_realm->scheduler()->is_on_thread()) {
         // We can get here in two cases: if the user is trying to open a
         // queue-bound Realm from the wrong queue, or if we have a stale cached
@@ -74,35 +179,161 @@ RLMRealm *RLMGetAnyCachedRealm(__unsafe_unretained RLMRealmConfiguration *const
 }
 
 RLMRealm *RLMGetAnyCachedRealmForPath(std::string const& path) {
-    std::lock_guard lock(s_realmCacheMutex);
-    return [s_realmsPerPath[path] objectEnumerator].nextObject;
+    for (auto& shard : s_realmCacheShards) {
+        std::lock_guard lock(shard.mutex);
+        for (auto& [key, realms] : shard.realms) {
+            for (auto& cached : realms) {
+                if (cached.path == path) {
+                    if (RLMRealm *realm = cached.realm) {
+                        return realm;
+                    }
+                }
+            }
+        }
+    }
+    std::lock_guard lock(s_frozenRealmsMutex);
+    auto it = s_frozenRealms.find(path);
+    if (it != s_frozenRealms.end()) {
+        for (auto& entry : it->second.entries) {
+            if (RLMRealm *realm = entry.realm) {
+                return realm;
+            }
+        }
+    }
+    return nil;
 }
 
 void RLMClearRealmCache() {
-    std::lock_guard lock(s_realmCacheMutex);
-    s_realmsPerPath.clear();
-    s_frozenRealms.clear();
+    for (auto& shard : s_realmCacheShards) {
+        std::lock_guard lock(shard.mutex);
+        shard.realms.clear();
+        shard.pruneThreshold = 16;
+    }
+    // Destroy the retained frozen Realms after releasing the lock
+    std::map<std::string, FrozenRealmsForPath> frozenRealms;
+    std::lock_guard lock(s_frozenRealmsMutex);
+    s_frozenRealms.swap(frozenRealms);
 }
 
-RLMRealm *RLMGetFrozenRealmForSourceRealm(__unsafe_unretained RLMRealm *const sourceRealm) {
-    std::lock_guard lock(s_realmCacheMutex);
-    auto& r = *sourceRealm->_realm;
-    auto& path = r.config().path;
-    NSMapTable *realms = s_realmsPerPath[path];
-    if (!realms) {
-        s_realmsPerPath[path] = realms = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsIntegerPersonality|NSPointerFunctionsOpaqueMemory
-                                                               valueOptions:NSPointerFunctionsWeakMemory];
+// Drop the cache's strong reference to the least recently used versions which
+// aren't pinned until at most s_maximumFrozenVersions are retained. Frozen
+// Realms can be in use on any thread, so evicted Realms are not closed; their
+// version is released when the last reference to them goes away. The released
+// Realms are moved into `released` so that the caller can destroy them after
+// releasing the lock.
+static void evictFrozenRealms(FrozenRealmsForPath& frozen, std::vector<RLMRealm *>& released) {
+    while (true) {
+        size_t retainedCount = 0;
+        FrozenRealmEntry *lru = nullptr;
+        for (auto& entry : frozen.entries) {
+            if (!entry.retained || entry.pinCount) {
+                continue;
+            }
+            ++retainedCount;
+            if (!lru || entry.lastUsed < lru->lastUsed) {
+                lru = &entry;
+            }
+        }
+        if (retainedCount <= s_maximumFrozenVersions) {
+            break;
+        }
+        released.push_back(std::move(lru->retained));
+        lru->retained = nil;
+        ++frozen.evictions;
     }
+}
+
+RLMRealm *RLMGetFrozenRealmForSourceRealm(__unsafe_unretained RLMRealm *const sourceRealm, bool pin) {
+    RLMRealm *realm;
+    std::vector<RLMRealm *> released;
+    std::lock_guard lock(s_frozenRealmsMutex);
+    auto& r = *sourceRealm->_realm;
+    auto& frozen = s_frozenRealms[r.config().path];
+    frozen.pruneDeadEntries();
     r.read_group();
-    auto version = reinterpret_cast<void *>(r.read_transaction_version().version);
-    RLMRealm *realm = [realms objectForKey:(__bridge id)version];
-    if (!realm) {
+    auto version = r.read_transaction_version().version;
+    auto entry = frozen.find(version);
+    if (entry && (realm = entry->realm)) {
+        ++frozen.hits;
+    }
+    else {
+        ++frozen.misses;
         realm = [sourceRealm frozenCopy];
-        [realms setObject:realm forKey:(__bridge id)version];
+        if (!entry) {
+            entry = &frozen.entries.emplace_back(FrozenRealmEntry{.version = version});
+        }
+        entry->realm = realm;
+    }
+    entry->lastUsed = ++s_frozenRealmClock;
+    entry->pinCount += pin;
+    if (s_maximumFrozenVersions) {
+        entry->retained = realm;
+        evictFrozenRealms(frozen, released);
     }
     return realm;
 }
 
+void RLMSetMaximumFrozenVersions(size_t maximum) {
+    std::vector<RLMRealm *> released;
+    std::lock_guard lock(s_frozenRealmsMutex);
+    s_maximumFrozenVersions = maximum;
+    for (auto& [path, frozen] : s_frozenRealms) {
+        evictFrozenRealms(frozen, released);
+    }
+}
+
+size_t RLMGetMaximumFrozenVersions() {
+    std::lock_guard lock(s_frozenRealmsMutex);
+    return s_maximumFrozenVersions;
+}
+
+RLMFrozenRealmCacheCounts RLMGetFrozenRealmCacheCounts(std::string const& path) {
+    std::lock_guard lock(s_frozenRealmsMutex);
+    RLMFrozenRealmCacheCounts counts{};
+    auto it = s_frozenRealms.find(path);
+    if (it == s_frozenRealms.end()) {
+        return counts;
+    }
+    auto& frozen = it->second;
+    frozen.pruneDeadEntries();
+    counts.versions = frozen.entries.size();
+    counts.pinnedVersions = std::count_if(frozen.entries.begin(), frozen.entries.end(),
+                                          [](auto& entry) { return entry.pinCount > 0; });
+    counts.hits = frozen.hits;
+    counts.misses = frozen.misses;
+    counts.evictions = frozen.evictions;
+    return counts;
+}
+
+void RLMPinFrozenRealm(__unsafe_unretained RLMRealm *const frozenRealm) {
+    auto& r = *frozenRealm->_realm;
+    auto version = r.read_transaction_version().version;
+    std::lock_guard lock(s_frozenRealmsMutex);
+    auto& frozen = s_frozenRealms[r.config().path];
+    auto entry = frozen.find(version);
+    if (!entry) {
+        entry = &frozen.entries.emplace_back(FrozenRealmEntry{.version = version, .realm = frozenRealm});
+    }
+    else if (!entry->realm) {
+        entry->realm = frozenRealm;
+    }
+    entry->lastUsed = ++s_frozenRealmClock;
+    ++entry->pinCount;
+}
+
+void RLMUnpinFrozenRealm(__unsafe_unretained RLMRealm *const frozenRealm) {
+    auto& r = *frozenRealm->_realm;
+    auto version = r.read_transaction_version().version;
+    std::lock_guard lock(s_frozenRealmsMutex);
+    auto it = s_frozenRealms.find(r.config().path);
+    if (it == s_frozenRealms.end()) {
+        return;
+    }
+    if (auto entry = it->second.find(version); entry && entry->pinCount) {
+        --entry->pinCount;
+    }
+}
+
 namespace {
 void advance_to_ready(realm::Realm& realm) {
     if (!realm.auto_refresh()) {
@@ -113,6 +113,87 @@ RLM_HEADER_AUDIT_BEGIN(nullability)
  */
 -(RLMObject *)createObject:(NSString *)className withValue:(id)value;
 
+/**
+ Creates an `RLMObject` instance of type `className` in the Realm for each value in `values`.
+
+ This is equivalent to calling `createObject:withValue:` for each value, but
+ looks up the type and sets up the state needed to create objects only once
+ rather than once per object, which makes it considerably faster when creating
+ large numbers of objects.
+
+ Each value is interpreted in the same way as the `value` argument to
+ `createObject:withValue:`.
+
+ @warning This method may only be called during a write transaction.
+
+ @param className The class name of the objects to create.
+ @param values    An enumerable collection of values used to populate the objects.
+
+ @return    An array containing the created objects, in the same order as `values`.
+ */
+- (NSArray<RLMObject *> *)createObjects:(NSString *)className withValues:(id<NSFastEnumeration>)values;
+
+/**
+ Creates an `RLMObject` instance of type `className` in the Realm for each value
+ in `values` without returning the created objects.
+
+ This behaves like `createObjects:withValues:`, but skips creating accessor
+ objects for the newly created objects, and reports progress periodically for
+ long-running imports.
+
+ @warning This method may only be called during a write transaction.
+
+ @param className The class name of the objects to create.
+ @param values    An enumerable collection of values used to populate the objects.
+ @param batchSize The number of objects to create between each call to `progress`.
+                  If zero, `progress` is only called once all objects have been created.
+ @param progress  A block which is called with the total number of objects
+                  created so far after every `batchSize` objects and once
+                  after all of the objects have been created.
+ */
+- (void)createObjects:(NSString *)className
+           withValues:(id<NSFastEnumeration>)values
+            batchSize:(NSUInteger)batchSize
+             progress:(nullable void (^)(NSUInteger count))progress;
+
+/**
+ Creates `count` `RLMObject` instances of type `className` in the Realm from
+ column-oriented buffers of raw values.
+
+ Each entry in `columns` maps a property name to a buffer containing the value
+ of that property for every object to create, in order. The values are written
+ directly to the Realm without being converted to Objective-C objects, and each
+ column is validated once rather than once per value, which makes this much
+ faster than `createObjects:withValues:` for data which is already stored in
+ columns. The buffers must use the following formats:
+
+ - `RLMPropertyTypeInt`: `count` `int64_t` values.
+ - `RLMPropertyTypeBool`: `count` `bool` values.
+ - `RLMPropertyTypeFloat`: `count` `float` values.
+ - `RLMPropertyTypeDouble`: `count` `double` values.
+ - `RLMPropertyTypeDate`: `count` `double` values, each the number of seconds
+   since 00:00:00 UTC on 1 January 1970.
+ - `RLMPropertyTypeString`: `count` UTF-8 strings, each followed by a NUL byte.
+
+ Other property types, including collections and links, cannot be imported
+ from columns. Properties without a column are set to their default value,
+ or left `nil` or empty if they are optional or a collection.
+
+ Integer values are not checked against the declared size of the property,
+ and null values cannot be represented in a column buffer.
+
+ @warning This method may only be called during a write transaction. If an
+          exception is thrown partway through, the objects created before the
+          error remain in the write transaction.
+
+ @param className The class name of the objects to create.
+ @param count     The number of objects to create.
+ @param columns   A dictionary mapping property names to buffers of values.
+ */
+- (void)createObjects:(NSString *)className
+                count:(NSUInteger)count
+          withColumns:(NSDictionary<NSString *, NSData *> *)columns;
+
 @end
 
 RLM_HEADER_AUDIT_END(nullability)
@@ -144,6 +144,30 @@ typedef NS_ENUM(NSUInteger, RLMWaitForSyncMode) {
  */
 - (nullable RLMObjectType)lastObject;
 
+/**
+ Returns an object which can be used to fast-enumerate the results collection,
+ reading `windowSize` objects at a time.
+
+ Enumerating an `RLMResults` directly reads 16 objects at a time. Enumerating
+ the returned object instead reads and creates accessors for `windowSize`
+ objects at once, which reduces the per-batch overhead when enumerating very
+ large collections at the cost of keeping up to `windowSize` accessors alive
+ at a time.
+
+     for (Dog *dog in [[Dog allObjects] enumeratorWithPrefetchWindow:1024]) {
+         NSLog(@"%@", dog.name);
+     }
+
+ The returned object can be enumerated any number of times, and each
+ enumeration reads the current contents of the results. The same rules apply
+ to it as to enumerating the results directly: each enumeration operates on a
+ snapshot if started inside a write transaction, and it must be used on the
+ thread which it was created on.
+
+ @param windowSize The number of objects to read at a time. Must be greater than zero.
+ */
+- (id<NSFastEnumeration>)enumeratorWithPrefetchWindow:(NSUInteger)windowSize;
+
 #pragma mark - Querying Results
 
 /**
@@ -644,6 +668,44 @@ __attribute__((swift_attr("@_unsafeInheritExecutor")));
  */
 - (nullable NSNumber *)averageOfProperty:(NSString *)property;
 
+#pragma mark - Reading Property Values
+
+/**
+ Returns the values of the given property for each object in the results collection, packed
+ into a buffer of consecutive `int64_t` values in the same order as the objects.
+
+     NSData *ages = [results int64ValuesOfProperty:@"age"];
+     const int64_t *values = ages.bytes;
+
+ The values are read directly from the Realm without creating an object or
+ `NSNumber` for each value, which makes this much faster than `valueForKey:`
+ for reading a single property of many objects.
+
+ @param property The property whose values are desired. Only non-optional `int`
+                 properties are supported.
+
+ @return A buffer containing one `int64_t` value for each object.
+ */
+- (NSData *)int64ValuesOfProperty:(NSString *)property;
+
+/**
+ Returns the values of the given property for each object in the results collection, packed
+ into a buffer of consecutive `double` values in the same order as the objects.
+
+     NSData *prices = [results doubleValuesOfProperty:@"price"];
+     const double *values = prices.bytes;
+
+ The values are read directly from the Realm without creating an object or
+ `NSNumber` for each value. `int` and `float` values are converted to `double`,
+ dates are stored as seconds since 1970, and `nil` values are stored as NaN.
+
+ @param property The property whose values are desired. Only properties of
+                 types `int`, `float`, `double`, and `NSDate` are supported.
+
+ @return A buffer containing one `double` value for each object.
+ */
+- (NSData *)doubleValuesOfProperty:(NSString *)property;
+
 /// :nodoc:
 - (RLMObjectType)objectAtIndexedSubscript:(NSUInteger)index;
 
@@ -741,4 +803,84 @@ __attribute__((swift_attr("@_unsafeInheritExecutor")));
 @interface RLMLinkingObjects<RLMObjectType: RLMObject *> : RLMResults
 @end
 
+/**
+ `RLMPreparedQuery` is a query which is parsed once and can then be run many
+ times with different argument values.
+
+ Running a query with `-[RLMResults objectsWhere:]` parses the predicate format
+ string each time it is called. When the same query is run repeatedly with
+ different values, such as in a loop or in response to user input, an
+ `RLMPreparedQuery` can be used to perform that work once:
+
+     RLMPreparedQuery *query = [RLMPreparedQuery queryWithClassName:@"Person"
+                                                              where:@"age > %@ AND name BEGINSWITH %@"];
+     RLMResults *adults = [query resultsInRealm:realm arguments:@[@18, @"J"]];
+
+ Arguments are given positionally, and must be supplied for each `%@` in the
+ predicate format. Other format specifiers such as `%K` and `%d` are not
+ supported. Prepared queries are immutable and may be used on any thread.
+
+ Only parsing the format string is done once. Each run still copies the parsed
+ predicate with the arguments substituted in and converts it to a query on the
+ Realm, so the cost of running a prepared query grows with the size of the
+ predicate just as for an unprepared one.
+ */
+RLM_SWIFT_SENDABLE RLM_FINAL // immutable final class
+@interface RLMPreparedQuery<RLMObjectType> : NSObject
+
+/**
+ Creates a prepared query for objects of the given type from a predicate format string.
+
+ @param className       The name of the object type which the query is run on.
+ @param predicateFormat A predicate format string using `%@` for each argument.
+ */
++ (instancetype)queryWithClassName:(NSString *)className where:(NSString *)predicateFormat;
+
+/// The name of the object type which the query is run on.
+@property (nonatomic, readonly) NSString *objectClassName;
+
+/// The predicate format string which the query was created from.
+@property (nonatomic, readonly) NSString *predicateFormat;
+
+/// The number of arguments which must be supplied when running the query.
+@property (nonatomic, readonly) NSUInteger argumentCount;
+
+/**
+ Returns all objects of the query's type in the given Realm which match the query.
+
+ @param realm     The Realm to run the query on.
+ @param arguments The values to use for each `%@` in the predicate format, in order.
+                  Use `NSNull` for `nil` values.
+
+ @return An `RLMResults` containing the matching objects.
+ */
+- (RLMResults<RLMObjectType> *)resultsInRealm:(RLMRealm *)realm arguments:(NSArray *)arguments;
+
+/**
+ Returns the objects in the given results which match the query.
+
+ @param results   The results to filter. Must contain objects of the query's type.
+ @param arguments The values to use for each `%@` in the predicate format, in order.
+                  Use `NSNull` for `nil` values.
+
+ @return An `RLMResults` containing the matching objects.
+ */
+- (RLMResults<RLMObjectType> *)resultsFromResults:(RLMResults<RLMObjectType> *)results arguments:(NSArray *)arguments;
+
+/**
+ Returns the predicate for the query with the given argument values.
+
+ @param arguments The values to use for each `%@` in the predicate format, in order.
+ */
+- (NSPredicate *)predicateWithArguments:(NSArray *)arguments;
+
+#pragma mark - Unavailable Methods
+
+/// `RLMPreparedQuery` must be created with `+[RLMPreparedQuery queryWithClassName:where:]`.
+- (instancetype)init __attribute__((unavailable("Use +queryWithClassName:where:")));
+/// `RLMPreparedQuery` must be created with `+[RLMPreparedQuery queryWithClassName:where:]`.
++ (instancetype)new __attribute__((unavailable("Use +queryWithClassName:where:")));
+
+@end
+
 RLM_HEADER_AUDIT_END(nullability, sendability)
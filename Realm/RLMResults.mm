@@ -58,6 +58,14 @@ using namespace realm;
 // private properties
 @interface RLMResults ()
 @property (nonatomic, nullable) RLMObjectId *associatedSubscriptionId;
+- (RLMFastEnumerator *)fastEnumeratorWithWindowSize:(NSUInteger)windowSize;
+@end
+
+// The object returned from -enumeratorWithPrefetchWindow:. It creates a new
+// RLMFastEnumerator each time enumeration starts so that it can be enumerated
+// more than once, and retains the results which the enumerators point into.
+@interface RLMPrefetchingEnumerable : NSObject <NSFastEnumeration>
+- (instancetype)initWithResults:(RLMResults *)results windowSize:(NSUInteger)windowSize;
 @end
 
 //
@@ -80,6 +88,92 @@ using namespace realm;
     return self;
 }
 
+namespace {
+enum class AggregateOperation { Min, Max, Sum, Average };
+
+NSString *aggregateMethodName(AggregateOperation op) {
+    switch (op) {
+        case AggregateOperation::Min:     return @"minOfProperty";
+        case AggregateOperation::Max:     return @"maxOfProperty";
+        case AggregateOperation::Sum:     return @"sumOfProperty";
+        case AggregateOperation::Average: return @"averageOfProperty";
+    }
+}
+
+// Folds individual values and per-collection partial aggregates into a single
+// result. Sums are kept in the widest type needed for the property so that
+// combining partial sums gives the same result as core's column aggregates.
+struct AggregateAccumulator {
+    AggregateOperation op;
+    RLMPropertyType type;
+    std::optional<Mixed> extreme;
+    int64_t intSum = 0;
+    double doubleSum = 0;
+    Decimal128 decimalSum{0};
+    size_t count = 0;
+
+    // `valueCount` is the number of values which were summed to produce `value`
+    void add(Mixed value, size_t valueCount = 1) {
+        if (value.is_null()) {
+            return;
+        }
+        switch (op) {
+            case AggregateOperation::Min:
+                if (!extreme || value < *extreme) {
+                    extreme = value;
+                }
+                return;
+            case AggregateOperation::Max:
+                if (!extreme || *extreme < value) {
+                    extreme = value;
+                }
+                return;
+            case AggregateOperation::Sum:
+            case AggregateOperation::Average:
+                break;
+        }
+        switch (value.get_type()) {
+            case type_Int:     intSum += value.get_int(); break;
+            case type_Float:   doubleSum += value.get_float(); break;
+            case type_Double:  doubleSum += value.get_double(); break;
+            case type_Decimal: decimalSum += value.get_decimal(); break;
+            // Non-numeric values in mixed properties are skipped, as in core
+            default: return;
+        }
+        count += valueCount;
+    }
+
+    Decimal128 decimalTotal() const {
+        return decimalSum + Decimal128(intSum) + Decimal128(doubleSum);
+    }
+
+    std::optional<Mixed> result() const {
+        bool isDecimal = type == RLMPropertyTypeDecimal128 || type == RLMPropertyTypeAny;
+        switch (op) {
+            case AggregateOperation::Min:
+            case AggregateOperation::Max:
+                return extreme;
+            case AggregateOperation::Sum:
+                if (isDecimal) {
+                    return Mixed(decimalTotal());
+                }
+                if (type == RLMPropertyTypeInt) {
+                    return Mixed(intSum);
+                }
+                return Mixed(doubleSum);
+            case AggregateOperation::Average:
+                if (count == 0) {
+                    return std::nullopt;
+                }
+                if (isDecimal) {
+                    return Mixed(decimalTotal() / Decimal128(int64_t(count)));
+                }
+                return Mixed((double(intSum) + doubleSum) / count);
+        }
+    }
+};
+} // anonymous namespace
+
 static void assertKeyPathIsNotNested(NSString *keyPath) {
     if ([keyPath rangeOfString:@"."].location != NSNotFound) {
         @throw RLMException(@"Nested key paths are not supported yet for KVC collection operators.");
@@ -312,28 +406,20 @@ static inline void RLMResultsValidateInWriteTransaction(__unsafe_unretained RLMR
     RLMCollectionSetValueForKey(self, key, value);
 }
 
-- (NSNumber *)_aggregateForKeyPath:(NSString *)keyPath
-                            method:(std::optional<Mixed> (Results::*)(ColKey))method
-                        methodName:(NSString *)methodName returnNilForEmpty:(BOOL)returnNilForEmpty {
-    assertKeyPathIsNotNested(keyPath);
-    return [self aggregate:keyPath method:method returnNilForEmpty:returnNilForEmpty];
-}
-
 - (NSNumber *)_minForKeyPath:(NSString *)keyPath {
-    return [self _aggregateForKeyPath:keyPath method:&Results::min methodName:@"@min" returnNilForEmpty:YES];
+    return [self aggregate:keyPath operation:AggregateOperation::Min];
 }
 
 - (NSNumber *)_maxForKeyPath:(NSString *)keyPath {
-    return [self _aggregateForKeyPath:keyPath method:&Results::max methodName:@"@max" returnNilForEmpty:YES];
+    return [self aggregate:keyPath operation:AggregateOperation::Max];
 }
 
 - (NSNumber *)_sumForKeyPath:(NSString *)keyPath {
-    return [self _aggregateForKeyPath:keyPath method:&Results::sum methodName:@"@sum" returnNilForEmpty:NO];
+    return [self aggregate:keyPath operation:AggregateOperation::Sum];
 }
 
 - (NSNumber *)_avgForKeyPath:(NSString *)keyPath {
-    assertKeyPathIsNotNested(keyPath);
-    return [self averageOfProperty:keyPath];
+    return [self aggregate:keyPath operation:AggregateOperation::Average];
 }
 
 - (NSArray *)_unionOfObjectsForKeyPath:(NSString *)keyPath {
@@ -433,35 +519,130 @@ static inline void RLMResultsValidateInWriteTransaction(__unsafe_unretained RLMR
     return [self objectAtIndex:index];
 }
 
-- (id)aggregate:(NSString *)property
-         method:(std::optional<Mixed> (Results::*)(ColKey))method
-returnNilForEmpty:(BOOL)returnNilForEmpty {
+- (id)aggregate:(NSString *)keyPath operation:(AggregateOperation)op {
     if (_results.get_mode() == Results::Mode::Empty) {
-        return returnNilForEmpty ? nil : @0;
+        return op == AggregateOperation::Sum ? @0 : nil;
+    }
+    if (self.type != RLMPropertyTypeObject) {
+        ColKey column;
+        if (![keyPath isEqualToString:@"self"]) {
+            column = _info->tableColumn(keyPath);
+        }
+        return [self aggregateColumn:column operation:op];
     }
-    ColKey column;
-    if (self.type == RLMPropertyTypeObject || ![property isEqualToString:@"self"]) {
-        column = _info->tableColumn(property);
+
+    // Plain properties are aggregated directly by core. Collections of
+    // primitives and properties of to-one links have no single column for
+    // core to aggregate over, so we visit each row and fold the values (or
+    // core's per-collection partial aggregates) together without boxing them.
+    RLMClassInfo *info = _info;
+    ColKey linkColumn;
+    NSString *propertyName = keyPath;
+    NSUInteger separator = [keyPath rangeOfString:@"."].location;
+    if (separator != NSNotFound) {
+        RLMProperty *link = RLMValidatedProperty(_info->rlmObjectSchema, [keyPath substringToIndex:separator]);
+        propertyName = [keyPath substringFromIndex:separator + 1];
+        if (link.type != RLMPropertyTypeObject || link.collection
+            || [propertyName rangeOfString:@"."].location != NSNotFound) {
+            @throw RLMException(@"Nested key paths are not supported yet for KVC collection operators.");
+        }
+        linkColumn = _info->tableColumn(link);
+        info = &_realm->_info[link.objectClassName];
     }
 
-    auto value = translateErrors([&] { return (_results.*method)(column); });
+    RLMProperty *property = RLMValidatedProperty(info->rlmObjectSchema, propertyName);
+    if (!linkColumn && !property.collection) {
+        return [self aggregateColumn:_info->tableColumn(property) operation:op];
+    }
+    if (!canAggregate(property.type, op == AggregateOperation::Min || op == AggregateOperation::Max)) {
+        @throw RLMException(@"%@: is not supported for %@ property '%@.%@'",
+                            aggregateMethodName(op), RLMTypeToString(property.type),
+                            info->rlmObjectSchema.className, property.name);
+    }
+
+    ColKey column = info->tableColumn(property);
+    bool isCollection = property.collection;
+    auto value = translateErrors([&] {
+        AggregateAccumulator accumulator{op, property.type};
+        TableView tv = _results.get_tableview();
+        for (size_t i = 0, size = tv.size(); i < size; ++i) {
+            Obj obj = tv[i];
+            if (linkColumn) {
+                if (obj.is_null(linkColumn)) {
+                    continue;
+                }
+                obj = obj.get_linked_object(linkColumn);
+            }
+            if (!isCollection) {
+                accumulator.add(obj.get_any(column));
+                continue;
+            }
+            auto collection = obj.get_collection_ptr(column);
+            if (op == AggregateOperation::Min) {
+                if (auto min = collection->min()) {
+                    accumulator.add(*min);
+                }
+            }
+            else if (op == AggregateOperation::Max) {
+                if (auto max = collection->max()) {
+                    accumulator.add(*max);
+                }
+            }
+            else {
+                size_t summed = 0;
+                if (auto sum = collection->sum(&summed)) {
+                    accumulator.add(*sum, summed);
+                }
+            }
+        }
+        return accumulator.result();
+    });
+    return value ? RLMMixedToObjc(*value) : nil;
+}
+
+- (id)aggregateColumn:(ColKey)column operation:(AggregateOperation)op {
+    auto value = translateErrors([&] {
+        switch (op) {
+            case AggregateOperation::Min:     return _results.min(column);
+            case AggregateOperation::Max:     return _results.max(column);
+            case AggregateOperation::Sum:     return _results.sum(column);
+            case AggregateOperation::Average: return _results.average(column);
+        }
+    });
     return value ? RLMMixedToObjc(*value) : nil;
 }
 
 - (id)minOfProperty:(NSString *)property {
-    return [self aggregate:property method:&Results::min returnNilForEmpty:YES];
+    return [self aggregate:property operation:AggregateOperation::Min];
 }
 
 - (id)maxOfProperty:(NSString *)property {
-    return [self aggregate:property method:&Results::max returnNilForEmpty:YES];
+    return [self aggregate:property operation:AggregateOperation::Max];
 }
 
 - (id)sumOfProperty:(NSString *)property {
-    return [self aggregate:property method:&Results::sum returnNilForEmpty:NO];
+    return [self aggregate:property operation:AggregateOperation::Sum];
 }
 
 - (id)averageOfProperty:(NSString *)property {
-    return [self aggregate:property method:&Results::average returnNilForEmpty:YES];
+    return [self aggregate:property operation:AggregateOperation::Average];
+}
+
+- (NSData *)packedValuesOfProperty:(NSString *)property asDouble:(bool)asDouble method:(SEL)method {
+    if (_results.get_mode() == Results::Mode::Empty) {
+        return [NSData data];
+    }
+    return translateErrors([&] {
+        return RLMCollectionPackedValues(_results, property, *_info, asDouble, method);
+    });
+}
+
+- (NSData *)int64ValuesOfProperty:(NSString *)property {
+    return [self packedValuesOfProperty:property asDouble:false method:_cmd];
+}
+
+- (NSData *)doubleValuesOfProperty:(NSString *)property {
+    return [self packedValuesOfProperty:property asDouble:true method:_cmd];
 }
 
 - (RLMSectionedResults *)sectionedResultsSortedUsingKeyPath:(NSString *)keyPath
@@ -510,6 +691,26 @@ returnNilForEmpty:(BOOL)returnNilForEmpty {
     });
 }
 
+- (RLMFastEnumerator *)fastEnumeratorWithWindowSize:(NSUInteger)windowSize {
+    return translateErrors([&] {
+        _results.evaluate_query_if_needed();
+        return [[RLMFastEnumerator alloc] initWithResults:_results
+                                               collection:self
+                                                classInfo:*_info
+                                               windowSize:windowSize];
+    });
+}
+
+- (id<NSFastEnumeration>)enumeratorWithPrefetchWindow:(NSUInteger)windowSize {
+    if (windowSize == 0) {
+        @throw RLMException(@"Prefetch window size must be greater than zero.");
+    }
+    if (!_info) {
+        return @[];
+    }
+    return [[RLMPrefetchingEnumerable alloc] initWithResults:self windowSize:windowSize];
+}
+
 - (RLMResults *)snapshot {
     return translateErrors([&] {
         return [self subresultsWithResults:_results.snapshot()];
@@ -726,8 +927,228 @@ keyPaths:(std::optional<std::vector<std::vector<std::pair<realm::TableKey, realm
 
 @end
 
+@implementation RLMPrefetchingEnumerable {
+    RLMResults *_results;
+    NSUInteger _windowSize;
+}
+
+- (instancetype)initWithResults:(RLMResults *)results windowSize:(NSUInteger)windowSize {
+    if ((self = [super init])) {
+        _results = results;
+        _windowSize = windowSize;
+    }
+    return self;
+}
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state
+                                  objects:(__unused __unsafe_unretained id [])buffer
+                                    count:(NSUInteger)len {
+    __autoreleasing RLMFastEnumerator *enumerator;
+    if (state->state == 0) {
+        enumerator = [_results fastEnumeratorWithWindowSize:_windowSize];
+        state->extra[0] = (long)enumerator;
+        state->extra[1] = _results.count;
+    }
+    else {
+        enumerator = (__bridge id)(void *)state->extra[0];
+    }
+    return [enumerator countByEnumeratingWithState:state count:len];
+}
+@end
+
 @implementation RLMLinkingObjects
 - (NSString *)description {
     return RLMDescriptionWithMaxDepth(@"RLMLinkingObjects", self, RLMDescriptionMaxDepth);
 }
 @end
+
+// A stand-in for an argument to a prepared query. These are passed to
+// +[NSPredicate predicateWithFormat:argumentArray:] in place of the real
+// arguments so that the predicate format only needs to be parsed once, and are
+// then replaced with the real arguments each time the query is run.
+@interface RLMQueryPlaceholder : NSObject {
+@public
+    NSUInteger _index;
+}
+@end
+
+@implementation RLMQueryPlaceholder
+@end
+
+namespace {
+NSPredicate *bindPredicate(NSPredicate *predicate, NSArray *arguments);
+
+NSExpression *bindExpression(NSExpression *expression, NSArray *arguments) {
+    switch (expression.expressionType) {
+        case NSConstantValueExpressionType: {
+            auto placeholder = RLMDynamicCast<RLMQueryPlaceholder>(expression.constantValue);
+            if (!placeholder) {
+                return expression;
+            }
+            id value = arguments[placeholder->_index];
+            return [NSExpression expressionForConstantValue:value == NSNull.null ? nil : value];
+        }
+        case NSAggregateExpressionType: {
+            NSArray *collection = RLMDynamicCast<NSArray>(expression.collection);
+            if (!collection) {
+                return expression;
+            }
+            bool changed = false;
+            NSMutableArray *bound = [NSMutableArray arrayWithCapacity:collection.count];
+            for (NSExpression *element in collection) {
+                NSExpression *boundElement = bindExpression(element, arguments);
+                changed |= boundElement != element;
+                [bound addObject:boundElement];
+            }
+            return changed ? [NSExpression expressionForAggregate:bound] : expression;
+        }
+        case NSFunctionExpressionType: {
+            bool changed = false;
+            NSMutableArray *bound = [NSMutableArray arrayWithCapacity:expression.arguments.count];
+            for (NSExpression *argument in expression.arguments) {
+                NSExpression *boundArgument = bindExpression(argument, arguments);
+                changed |= boundArgument != argument;
+                [bound addObject:boundArgument];
+            }
+            NSExpression *operand = bindExpression(expression.operand, arguments);
+            if (!changed && operand == expression.operand) {
+                return expression;
+            }
+            return [NSExpression expressionForFunction:operand selectorName:expression.function arguments:bound];
+        }
+        case NSSubqueryExpressionType: {
+            NSExpression *collection = bindExpression((NSExpression *)expression.collection, arguments);
+            NSPredicate *predicate = bindPredicate(expression.predicate, arguments);
+            if (collection == expression.collection && predicate == expression.predicate) {
+                return expression;
+            }
+            return [NSExpression expressionForSubquery:collection
+                                 usingIteratorVariable:expression.variable
+                                             predicate:predicate];
+        }
+        default:
+            return expression;
+    }
+}
+
+NSPredicate *bindPredicate(NSPredicate *predicate, NSArray *arguments) {
+    if (auto compound = RLMDynamicCast<NSCompoundPredicate>(predicate)) {
+        bool changed = false;
+        NSMutableArray *bound = [NSMutableArray arrayWithCapacity:compound.subpredicates.count];
+        for (NSPredicate *subpredicate in compound.subpredicates) {
+            NSPredicate *boundSubpredicate = bindPredicate(subpredicate, arguments);
+            changed |= boundSubpredicate != subpredicate;
+            [bound addObject:boundSubpredicate];
+        }
+        if (!changed) {
+            return predicate;
+        }
+        return [[NSCompoundPredicate alloc] initWithType:compound.compoundPredicateType subpredicates:bound];
+    }
+    if (auto comparison = RLMDynamicCast<NSComparisonPredicate>(predicate)) {
+        NSExpression *left = bindExpression(comparison.leftExpression, arguments);
+        NSExpression *right = bindExpression(comparison.rightExpression, arguments);
+        if (left == comparison.leftExpression && right == comparison.rightExpression) {
+            return predicate;
+        }
+        if (comparison.predicateOperatorType == NSCustomSelectorPredicateOperatorType) {
+            return [NSComparisonPredicate predicateWithLeftExpression:left rightExpression:right
+                                                       customSelector:comparison.customSelector];
+        }
+        return [NSComparisonPredicate predicateWithLeftExpression:left rightExpression:right
+                                                         modifier:comparison.comparisonPredicateModifier
+                                                             type:comparison.predicateOperatorType
+                                                          options:comparison.options];
+    }
+    return predicate;
+}
+
+// Count the `%@` specifiers in a predicate format string, rejecting any other
+// format specifiers since we only have objects to pass in their place
+NSUInteger countPlaceholders(NSString *predicateFormat) {
+    NSUInteger count = 0;
+    unichar quote = 0;
+    NSUInteger length = predicateFormat.length;
+    for (NSUInteger i = 0; i < length; ++i) {
+        unichar c = [predicateFormat characterAtIndex:i];
+        if (quote) {
+            if (c == '\\') {
+                ++i;
+            }
+            else if (c == quote) {
+                quote = 0;
+            }
+            continue;
+        }
+        if (c == '"' || c == '\'') {
+            quote = c;
+            continue;
+        }
+        if (c != '%') {
+            continue;
+        }
+        unichar specifier = i + 1 < length ? [predicateFormat characterAtIndex:++i] : 0;
+        if (specifier == '@') {
+            ++count;
+        }
+        else if (specifier != '%') {
+            @throw RLMException(@"Invalid predicate format '%@': prepared queries only support '%%@' "
+                                @"format specifiers.", predicateFormat);
+        }
+    }
+    return count;
+}
+} // anonymous namespace
+
+@implementation RLMPreparedQuery {
+    NSPredicate *_predicate;
+}
+
++ (instancetype)queryWithClassName:(NSString *)className where:(NSString *)predicateFormat {
+    return [[self alloc] initWithClassName:className predicateFormat:predicateFormat];
+}
+
+- (instancetype)initWithClassName:(NSString *)className predicateFormat:(NSString *)predicateFormat {
+    self = [super init];
+    if (self) {
+        _objectClassName = [className copy];
+        _predicateFormat = [predicateFormat copy];
+        _argumentCount = countPlaceholders(predicateFormat);
+
+        NSMutableArray *placeholders = [NSMutableArray arrayWithCapacity:_argumentCount];
+        for (NSUInteger i = 0; i < _argumentCount; ++i) {
+            RLMQueryPlaceholder *placeholder = [RLMQueryPlaceholder new];
+            placeholder->_index = i;
+            [placeholders addObject:placeholder];
+        }
+        _predicate = [NSPredicate predicateWithFormat:_predicateFormat argumentArray:placeholders];
+    }
+    return self;
+}
+
+- (NSPredicate *)predicateWithArguments:(NSArray *)arguments {
+    if (arguments.count != _argumentCount) {
+        @throw RLMException(@"Prepared query '%@' requires %llu arguments, but %llu were supplied.",
+                            _predicateFormat, (unsigned long long)_argumentCount,
+                            (unsigned long long)arguments.count);
+    }
+    return bindPredicate(_predicate, arguments);
+}
+
+- (RLMResults *)resultsInRealm:(RLMRealm *)realm arguments:(NSArray *)arguments {
+    return RLMGetObjects(realm, _objectClassName, [self predicateWithArguments:arguments]);
+}
+
+- (RLMResults *)resultsFromResults:(RLMResults *)results arguments:(NSArray *)arguments {
+    if (![results.objectClassName isEqualToString:_objectClassName]) {
+        @throw RLMException(@"Prepared query for objects of type '%@' cannot be used on results of type '%@'.",
+                            _objectClassName, results.objectClassName);
+    }
+    return [results objectsWithPredicate:[self predicateWithArguments:arguments]];
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"RLMPreparedQuery<%@>(%@)", _objectClassName, _predicateFormat];
+}
+
+@end
@@ -44,6 +44,53 @@ RLM_SWIFT_SENDABLE // not actually immutable, but the public API kinda is
  */
 @property (nonatomic, readonly, copy) NSArray<RLMObjectSchema *> *objectSchema;
 
+/**
+ The location of an on-disk manifest of the schema discovered from the model
+ classes in the app, or `nil` (the default) to not use a manifest.
+
+ Building the default schema requires scanning every Objective-C class in the
+ process and introspecting the properties of each model class, which can take
+ a noticeable amount of time at launch in large apps. If this is set, the
+ result of that discovery is saved to the given file the first time the
+ default schema is built, and subsequent launches of the same build of the app
+ read the schema from the manifest instead.
+
+ The manifest is tied to the build UUIDs of the app's executable and of each
+ binary which defines model classes, and is ignored and rewritten if any of
+ them have changed.
+
+ This must be set before the first Realm using the default schema is opened,
+ and has no effect after that.
+ */
+@property (class, nonatomic, copy, nullable) NSURL *manifestURL NS_REFINED_FOR_SWIFT;
+
+/**
+ Whether the accessor classes for each model class are created the first time
+ objects of that class are used rather than when the schema is built. Defaults
+ to `NO`.
+
+ Realm creates subclasses of each model class at runtime to implement the
+ managed and unmanaged property accessors. Creating these for every model
+ class when the first Realm is opened can be a significant part of the time
+ taken to open it in apps with many model classes, even if only a few of them
+ are used right away. When this is set, each class's accessors are instead
+ created the first time an object of that class is created or read.
+
+ This must be set before the first Realm is opened, and only affects classes
+ whose schema is built after it is set.
+ */
+@property (class, nonatomic) BOOL createsAccessorClassesLazily;
+
+/**
+ The number of model classes which have had accessor classes created so far.
+ */
+@property (class, nonatomic, readonly) NSUInteger materializedAccessorClassCount;
+
+/**
+ The total time in seconds spent creating accessor classes so far.
+ */
+@property (class, nonatomic, readonly) NSTimeInterval accessorClassCreationTime;
+
 #pragma mark - Methods
 
 /**
@@ -23,6 +23,7 @@
 #import "RLMObject_Private.hpp"
 #import "RLMObjectSchema_Private.hpp"
 #import "RLMProperty_Private.h"
+#import "RLMQueryUtil.hpp"
 #import "RLMRealm_Private.hpp"
 #import "RLMSwiftSupport.h"
 #import "RLMUtil.hpp"
@@ -33,9 +34,17 @@
 #import <realm/object-store/schema.hpp>
 #import <realm/util/scope_exit.hpp>
 
+#import <atomic>
+#import <chrono>
+#import <mach-o/dyld.h>
+#import <mach-o/loader.h>
 #import <mutex>
 #import <objc/runtime.h>
 
+#if !defined(REALM_COCOA_VERSION)
+#import "RLMVersion.h"
+#endif
+
 using namespace realm;
 
 const uint64_t RLMNotVersioned = realm::ObjectStore::NotVersioned;
@@ -68,12 +77,26 @@ static enum class SharedSchemaState {
     Initialized
 } s_sharedSchemaState = SharedSchemaState::Uninitialized;
 
+// Guarded by s_localNameToClass
+static NSURL *s_manifestURL;
+static bool s_sharedSchemaWasReadFromManifest = false;
+static NSUInteger s_materializedAccessorClassCount = 0;
+static std::chrono::steady_clock::duration s_accessorClassCreationTime{};
+
+static std::atomic<bool> s_createsAccessorClassesLazily{false};
+
 @implementation RLMSchema {
     NSArray *_objectSchema;
+    // Lazily built the first time the schema is used to open a Realm. Realms
+    // for different files can be opened concurrently, so this is guarded.
+    RLMUnfairMutex _objectStoreSchemaMutex;
     realm::Schema _objectStoreSchema;
+    std::shared_ptr<RLMKeyPathCache> _keyPathCache;
 }
 
+// Caller must @synchronize on s_localNameToClass
 static void createAccessors(RLMObjectSchema *objectSchema) {
+    auto creationStart = std::chrono::steady_clock::now();
     constexpr const size_t bufferSize
         = sizeof("RLM:Managed  ") // includes spot for null terminator
         + std::numeric_limits<unsigned long long>::digits10
@@ -87,21 +110,77 @@ static void createAccessors(RLMObjectSchema *objectSchema) {
              "%llu %s", count++, objectSchema.className.UTF8String);
     objectSchema.accessorClass = RLMManagedAccessorClassForObjectClass(objectSchema.objectClass, objectSchema, className);
     objectSchema.unmanagedClass = RLMUnmanagedAccessorClassForObjectClass(objectSchema.objectClass, objectSchema);
+    objectSchema.accessorsCreated = true;
+
+    s_accessorClassCreationTime += std::chrono::steady_clock::now() - creationStart;
+    ++s_materializedAccessorClassCount;
 }
 
 void RLMSchemaEnsureAccessorsCreated(RLMSchema *schema) {
     for (RLMObjectSchema *objectSchema in schema.objectSchema) {
-        if (objectSchema.accessorClass == objectSchema.objectClass) {
-            // Locking inside the loop to optimize for the common case at
-            // the expense of worse perf in the rare scenario where this is
-            // actually needed.
-            @synchronized(s_localNameToClass) {
+        // Realms for different files may be opened concurrently with the same
+        // schema, so the classes themselves are only inspected while holding
+        // the lock. Outside of it only the atomic flags are read, as another
+        // thread may be partway through setting the classes.
+        if (objectSchema.accessorsCreated || objectSchema.accessorsPending) {
+            continue;
+        }
+        // Locking inside the loop to optimize for the common case at
+        // the expense of worse perf in the rare scenario where this is
+        // actually needed.
+        @synchronized(s_localNameToClass) {
+            if (objectSchema.accessorsCreated || objectSchema.accessorsPending) {
+                // Another thread won the race
+            }
+            else if (objectSchema.accessorClass != objectSchema.objectClass) {
+                // Accessors which were set up some other way, such as for
+                // dynamic schemas
+                objectSchema.accessorsCreated = true;
+            }
+            else if (s_createsAccessorClassesLazily) {
+                objectSchema.accessorsPending = true;
+            }
+            else {
                 createAccessors(objectSchema);
             }
         }
     }
 }
 
+void RLMSchemaCreatePendingAccessors(RLMObjectSchema *objectSchema) {
+    @synchronized(s_localNameToClass) {
+        // Another thread may have created them while we waited for the lock
+        if (!objectSchema.accessorsPending) {
+            return;
+        }
+        createAccessors(objectSchema);
+        // The shared schema's object schemas also defer overriding sharedSchema
+        if (s_privateSharedSchema.objectSchemaByName[objectSchema.className] == objectSchema) {
+            RLMReplaceSharedSchemaMethod(objectSchema.objectClass, objectSchema);
+        }
+        // Must be cleared only after the classes are set, as other threads
+        // read them without locking once this is false
+        objectSchema.accessorsPending = false;
+    }
+}
+
+// Caller must @synchronize on s_localNameToClass
+static void addObjectSchema(Class cls, RLMObjectSchema *schema, SharedSchemaState prevState) {
+    if (s_createsAccessorClassesLazily) {
+        schema.accessorsPending = true;
+    }
+    else {
+        createAccessors(schema);
+        // override sharedSchema class methods for performance
+        RLMReplaceSharedSchemaMethod(cls, schema);
+    }
+
+    s_privateSharedSchema.objectSchemaByName[schema.className] = schema;
+    if ([cls shouldIncludeInDefaultSchema] && prevState != SharedSchemaState::Initialized) {
+        s_sharedSchema.objectSchemaByName[schema.className] = schema;
+    }
+}
+
 // Caller must @synchronize on s_localNameToClass
 static RLMObjectSchema *registerClass(Class cls) {
     if (RLMObjectSchema *schema = s_privateSharedSchema[[cls className]]) {
@@ -118,15 +197,7 @@ static RLMObjectSchema *registerClass(Class cls) {
         schema = [RLMObjectSchema schemaForObjectClass:cls];
     }
 
-    createAccessors(schema);
-    // override sharedSchema class methods for performance
-    RLMReplaceSharedSchemaMethod(cls, schema);
-
-    s_privateSharedSchema.objectSchemaByName[schema.className] = schema;
-    if ([cls shouldIncludeInDefaultSchema] && prevState != SharedSchemaState::Initialized) {
-        s_sharedSchema.objectSchemaByName[schema.className] = schema;
-    }
-
+    addObjectSchema(cls, schema, prevState);
     return schema;
 }
 
@@ -169,10 +240,259 @@ static void RLMRegisterClassLocalNames(Class *classes, NSUInteger count) {
     }
 }
 
+#pragma mark - Schema manifest
+
+static const NSInteger s_manifestFormatVersion = 1;
+
+// The LC_UUID of the loaded image with the given path, which changes whenever
+// the binary is rebuilt
+static NSString *imageUUID(const char *imagePath) {
+    for (uint32_t i = 0, count = _dyld_image_count(); i < count; ++i) {
+        if (strcmp(_dyld_get_image_name(i), imagePath) != 0) {
+            continue;
+        }
+        auto header = _dyld_get_image_header(i);
+        bool is64 = header->magic == MH_MAGIC_64;
+        auto cmd = reinterpret_cast<const load_command *>(reinterpret_cast<const char *>(header) + (is64 ? sizeof(mach_header_64) : sizeof(mach_header)));
+        for (uint32_t j = 0; j < header->ncmds; ++j) {
+            if (cmd->cmd == LC_UUID) {
+                auto uuid = reinterpret_cast<const uuid_command *>(cmd)->uuid;
+                return [[NSUUID alloc] initWithUUIDBytes:uuid].UUIDString;
+            }
+            cmd = reinterpret_cast<const load_command *>(reinterpret_cast<const char *>(cmd) + cmd->cmdsize);
+        }
+        return nil;
+    }
+    return nil;
+}
+
+static NSDictionary *manifestForProperty(RLMProperty *prop) {
+    NSMutableDictionary *dict = [NSMutableDictionary dictionary];
+    dict[@"name"] = prop.name;
+    dict[@"type"] = @(prop.type);
+    dict[@"indexed"] = @(prop.indexed);
+    dict[@"optional"] = @(prop.optional);
+    dict[@"array"] = @(prop.array);
+    dict[@"set"] = @(prop.set);
+    dict[@"dictionary"] = @(prop.dictionary);
+    dict[@"dictionaryKeyType"] = @(prop.dictionaryKeyType);
+    dict[@"legacy"] = @(prop.isLegacy);
+    dict[@"customMappingIsOptional"] = @(prop.customMappingIsOptional);
+    dict[@"swiftIvar"] = @(static_cast<long long>(prop.swiftIvar));
+    dict[@"getter"] = prop.getterName;
+    dict[@"setter"] = prop.setterName;
+    if (NSString *columnName = prop.columnName; ![columnName isEqualToString:prop.name]) {
+        dict[@"columnName"] = columnName;
+    }
+    if (prop.objectClassName) {
+        dict[@"objectClassName"] = prop.objectClassName;
+    }
+    if (prop.linkOriginPropertyName) {
+        dict[@"linkOriginPropertyName"] = prop.linkOriginPropertyName;
+    }
+    if (prop.swiftAccessor) {
+        dict[@"swiftAccessor"] = NSStringFromClass(prop.swiftAccessor);
+    }
+    return dict;
+}
+
+// Returns nil if the property refers to a class which can no longer be found
+static RLMProperty *propertyFromManifest(NSDictionary *dict) {
+    RLMProperty *prop = [[RLMProperty alloc] initWithName:dict[@"name"]
+                                                     type:static_cast<RLMPropertyType>([dict[@"type"] integerValue])
+                                          objectClassName:dict[@"objectClassName"]
+                                   linkOriginPropertyName:dict[@"linkOriginPropertyName"]
+                                                  indexed:[dict[@"indexed"] boolValue]
+                                                 optional:[dict[@"optional"] boolValue]];
+    prop.array = [dict[@"array"] boolValue];
+    prop.set = [dict[@"set"] boolValue];
+    prop.dictionary = [dict[@"dictionary"] boolValue];
+    prop.dictionaryKeyType = static_cast<RLMPropertyType>([dict[@"dictionaryKeyType"] integerValue]);
+    prop.isLegacy = [dict[@"legacy"] boolValue];
+    prop.customMappingIsOptional = [dict[@"customMappingIsOptional"] boolValue];
+    prop.swiftIvar = static_cast<ptrdiff_t>([dict[@"swiftIvar"] longLongValue]);
+    prop.columnName = dict[@"columnName"];
+    prop.getterName = dict[@"getter"];
+    prop.setterName = dict[@"setter"];
+    [prop updateAccessors];
+    if (NSString *accessorName = dict[@"swiftAccessor"]) {
+        prop.swiftAccessor = NSClassFromString(accessorName);
+        if (!prop.swiftAccessor) {
+            return nil;
+        }
+    }
+    return prop;
+}
+
+static NSArray<RLMProperty *> *propertiesFromManifest(NSArray<NSDictionary *> *array) {
+    NSMutableArray *properties = [NSMutableArray arrayWithCapacity:array.count];
+    for (NSDictionary *dict in array) {
+        RLMProperty *prop = propertyFromManifest(dict);
+        if (!prop) {
+            return nil;
+        }
+        [properties addObject:prop];
+    }
+    return properties;
+}
+
+// Returns nil if the object schema can't be reconstructed from the manifest,
+// in which case the class needs to be introspected
+static RLMObjectSchema *objectSchemaFromManifest(Class cls, NSDictionary *dict) {
+    NSArray *properties = propertiesFromManifest(dict[@"properties"]);
+    NSArray *computedProperties = propertiesFromManifest(dict[@"computedProperties"]);
+    if (!properties || !computedProperties) {
+        return nil;
+    }
+
+    RLMObjectSchema *schema = [[RLMObjectSchema alloc] initWithClassName:dict[@"className"]
+                                                             objectClass:cls
+                                                              properties:properties];
+    schema.computedProperties = computedProperties;
+    schema.isSwiftClass = [dict[@"swift"] boolValue];
+    schema.isEmbedded = [dict[@"embedded"] boolValue];
+    schema.isAsymmetric = [dict[@"asymmetric"] boolValue];
+    schema.hasCustomEventSerialization = [dict[@"customEventSerialization"] boolValue];
+    schema.usesStableIdentity = [cls usesStableIdentity];
+    if (NSString *primaryKey = dict[@"primaryKey"]) {
+        schema.primaryKeyProperty = schema[primaryKey];
+        if (!schema.primaryKeyProperty) {
+            return nil;
+        }
+    }
+    return schema;
+}
+
+static bool writeManifest(NSURL *url, NSArray<RLMObjectSchema *> *objectSchema) {
+    NSMutableDictionary *images = [NSMutableDictionary dictionary];
+    auto addImage = [&](const char *path) {
+        if (!path) {
+            return false;
+        }
+        NSString *key = @(path);
+        if (!images[key]) {
+            NSString *uuid = imageUUID(path);
+            if (!uuid) {
+                return false;
+            }
+            images[key] = uuid;
+        }
+        return true;
+    };
+    if (!addImage(_dyld_get_image_name(0))) {
+        return false;
+    }
+
+    NSMutableArray *classes = [NSMutableArray arrayWithCapacity:objectSchema.count];
+    for (RLMObjectSchema *schema in objectSchema) {
+        if (!addImage(class_getImageName(schema.objectClass))) {
+            return false;
+        }
+        NSMutableArray *properties = [NSMutableArray arrayWithCapacity:schema.properties.count];
+        for (RLMProperty *prop in schema.properties) {
+            [properties addObject:manifestForProperty(prop)];
+        }
+        NSMutableArray *computedProperties = [NSMutableArray arrayWithCapacity:schema.computedProperties.count];
+        for (RLMProperty *prop in schema.computedProperties) {
+            [computedProperties addObject:manifestForProperty(prop)];
+        }
+        NSMutableDictionary *dict = [NSMutableDictionary dictionary];
+        dict[@"class"] = @(class_getName(schema.objectClass));
+        dict[@"className"] = schema.className;
+        dict[@"swift"] = @(schema.isSwiftClass);
+        dict[@"embedded"] = @(schema.isEmbedded);
+        dict[@"asymmetric"] = @(schema.isAsymmetric);
+        dict[@"customEventSerialization"] = @(schema.hasCustomEventSerialization);
+        dict[@"properties"] = properties;
+        dict[@"computedProperties"] = computedProperties;
+        if (schema.primaryKeyProperty) {
+            dict[@"primaryKey"] = schema.primaryKeyProperty.name;
+        }
+        [classes addObject:dict];
+    }
+
+    NSDictionary *manifest = @{@"formatVersion": @(s_manifestFormatVersion),
+                               @"realmVersion": REALM_COCOA_VERSION,
+                               @"images": images,
+                               @"classes": classes};
+    NSData *data = [NSPropertyListSerialization dataWithPropertyList:manifest
+                                                              format:NSPropertyListBinaryFormat_v1_0
+                                                             options:0 error:nil];
+    return data && [data writeToURL:url options:NSDataWritingAtomic error:nil];
+}
+
+static NSArray<RLMObjectSchema *> *readManifest(NSURL *url) {
+    NSData *data = [NSData dataWithContentsOfURL:url options:NSDataReadingMappedIfSafe error:nil];
+    if (!data) {
+        return nil;
+    }
+    NSDictionary *manifest = [NSPropertyListSerialization propertyListWithData:data options:0 format:nullptr error:nil];
+    if (![manifest isKindOfClass:[NSDictionary class]]
+        || ![manifest[@"formatVersion"] isEqual:@(s_manifestFormatVersion)]
+        || ![manifest[@"realmVersion"] isEqual:REALM_COCOA_VERSION]) {
+        return nil;
+    }
+
+    // Any rebuild of the app or of a binary containing model classes may have
+    // changed the models, so the build UUIDs must all match
+    NSDictionary<NSString *, NSString *> *images = manifest[@"images"];
+    if (![images[@(_dyld_get_image_name(0))] isEqualToString:imageUUID(_dyld_get_image_name(0))]) {
+        return nil;
+    }
+    for (NSString *path in images) {
+        if (![images[path] isEqualToString:imageUUID(path.UTF8String)]) {
+            return nil;
+        }
+    }
+
+    NSArray<NSDictionary *> *classes = manifest[@"classes"];
+    NSMutableArray *objectSchema = [NSMutableArray arrayWithCapacity:classes.count];
+    for (NSDictionary *dict in classes) {
+        Class cls = objc_getClass([dict[@"class"] UTF8String]);
+        if (!cls || !RLMIsObjectSubclass(cls)) {
+            return nil;
+        }
+        // Swift accessor types are looked up by name and in rare cases might
+        // not be resolvable, so fall back to introspecting just that class
+        RLMObjectSchema *schema = objectSchemaFromManifest(cls, dict) ?: [RLMObjectSchema schemaForObjectClass:cls];
+        [objectSchema addObject:schema];
+    }
+    return objectSchema;
+}
+
++ (NSURL *)manifestURL {
+    @synchronized(s_localNameToClass) {
+        return s_manifestURL;
+    }
+}
+
++ (void)setManifestURL:(NSURL *)manifestURL {
+    @synchronized(s_localNameToClass) {
+        s_manifestURL = [manifestURL copy];
+    }
+}
+
++ (BOOL)sharedSchemaWasReadFromManifest {
+    @synchronized(s_localNameToClass) {
+        return s_sharedSchemaWasReadFromManifest;
+    }
+}
+
++ (BOOL)writeManifestForSchema:(RLMSchema *)schema toURL:(NSURL *)url {
+    return writeManifest(url, schema.objectSchema);
+}
+
++ (NSArray<RLMObjectSchema *> *)objectSchemaFromManifestAtURL:(NSURL *)url {
+    return readManifest(url);
+}
+
+#pragma mark -
+
 - (instancetype)init {
     self = [super init];
     if (self) {
         _objectSchemaByName = [[NSMutableDictionary alloc] init];
+        _keyPathCache = RLMMakeKeyPathCache();
     }
     return self;
 }
@@ -187,11 +507,24 @@ static void RLMRegisterClassLocalNames(Class *classes, NSUInteger count) {
 - (void)setObjectSchema:(NSArray *)objectSchema {
     _objectSchema = objectSchema;
     _objectSchemaByName = [NSMutableDictionary dictionaryWithCapacity:objectSchema.count];
+    RLMClearKeyPathCache(*_keyPathCache);
     for (RLMObjectSchema *object in objectSchema) {
         [_objectSchemaByName setObject:object forKey:object.className];
     }
 }
 
+- (RLMKeyPathCache&)keyPathCache {
+    return *_keyPathCache;
+}
+
+- (NSUInteger)keyPathCacheHits {
+    return (NSUInteger)RLMGetKeyPathCacheStats(*_keyPathCache).hits;
+}
+
+- (NSUInteger)keyPathCacheMisses {
+    return (NSUInteger)RLMGetKeyPathCacheStats(*_keyPathCache).misses;
+}
+
 - (RLMObjectSchema *)schemaForClassName:(NSString *)className {
     if (RLMObjectSchema *schema = _objectSchemaByName[className]) {
         return schema; // fast path for already-initialized schemas
@@ -263,6 +596,12 @@ static void RLMRegisterClassLocalNames(Class *classes, NSUInteger count) {
 
         RLMRegisterClassLocalNames(&cls, 1);
         RLMObjectSchema *objectSchema = registerClass(cls);
+        // Asking a class for its schema is the first use of the class, and
+        // creating the accessors also overrides this method so that later
+        // calls don't need to acquire the lock
+        if (objectSchema.accessorsPending) {
+            RLMSchemaCreatePendingAccessors(objectSchema);
+        }
         [cls initializeLinkedObjectSchemas];
         return objectSchema;
     }
@@ -293,17 +632,38 @@ static void RLMRegisterClassLocalNames(Class *classes, NSUInteger count) {
 
         s_sharedSchemaState = SharedSchemaState::Initializing;
         try {
-            // Make sure we've discovered all classes
-            {
-                unsigned int numClasses;
-                using malloc_ptr = std::unique_ptr<__unsafe_unretained Class[], decltype(&free)>;
-                malloc_ptr classes(objc_copyClassList(&numClasses), &free);
-                RLMRegisterClassLocalNames(classes.get(), numClasses);
+            if (NSArray *manifest = s_manifestURL ? readManifest(s_manifestURL) : nil) {
+                // The manifest was written from a fully discovered schema, so
+                // it's already been validated and has every class
+                for (RLMObjectSchema *objectSchema in manifest) {
+                    Class cls = objectSchema.objectClass;
+                    if (!s_localNameToClass[objectSchema.className]) {
+                        s_localNameToClass[objectSchema.className] = cls;
+                        RLMReplaceClassNameMethod(cls, objectSchema.className);
+                    }
+                    if (!s_privateSharedSchema[objectSchema.className]) {
+                        addObjectSchema(cls, objectSchema, SharedSchemaState::Initializing);
+                    }
+                }
+                s_sharedSchemaWasReadFromManifest = true;
+            }
+            else {
+                // Make sure we've discovered all classes
+                {
+                    unsigned int numClasses;
+                    using malloc_ptr = std::unique_ptr<__unsafe_unretained Class[], decltype(&free)>;
+                    malloc_ptr classes(objc_copyClassList(&numClasses), &free);
+                    RLMRegisterClassLocalNames(classes.get(), numClasses);
+                }
+
+                [s_localNameToClass enumerateKeysAndObjectsUsingBlock:^(NSString *, Class cls, BOOL *) {
+                    registerClass(cls);
+                }];
+
+                if (s_manifestURL) {
+                    writeManifest(s_manifestURL, s_privateSharedSchema.objectSchemaByName.allValues);
+                }
             }
-
-            [s_localNameToClass enumerateKeysAndObjectsUsingBlock:^(NSString *, Class cls, BOOL *) {
-                registerClass(cls);
-            }];
         }
         catch (...) {
             s_sharedSchemaState = SharedSchemaState::Uninitialized;
@@ -321,6 +681,26 @@ static void RLMRegisterClassLocalNames(Class *classes, NSUInteger count) {
     return s_sharedSchema;
 }
 
++ (BOOL)createsAccessorClassesLazily {
+    return s_createsAccessorClassesLazily;
+}
+
++ (void)setCreatesAccessorClassesLazily:(BOOL)createsAccessorClassesLazily {
+    s_createsAccessorClassesLazily = createsAccessorClassesLazily;
+}
+
++ (NSUInteger)materializedAccessorClassCount {
+    @synchronized(s_localNameToClass) {
+        return s_materializedAccessorClassCount;
+    }
+}
+
++ (NSTimeInterval)accessorClassCreationTime {
+    @synchronized(s_localNameToClass) {
+        return std::chrono::duration<NSTimeInterval>(s_accessorClassCreationTime).count();
+    }
+}
+
 // schema based on tables in a realm
 + (instancetype)dynamicSchemaFromObjectStoreSchema:(Schema const&)objectStoreSchema {
     // cache descriptors for all subclasses of RLMObject
@@ -388,6 +768,7 @@ static void RLMRegisterClassLocalNames(Class *classes, NSUInteger count) {
 }
 
 - (Schema)objectStoreCopy {
+    std::lock_guard lock(_objectStoreSchemaMutex);
     if (_objectStoreSchema.size() == 0) {
         std::vector<realm::ObjectSchema> schema;
         schema.reserve(_objectSchemaByName.count);
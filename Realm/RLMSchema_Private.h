@@ -53,6 +53,22 @@ RLM_HEADER_AUDIT_BEGIN(nullability)
 
 + (nullable RLMObjectSchema *)sharedSchemaForClass:(Class)cls;
 
+// Whether the shared schema was read from the manifest at `manifestURL` rather
+// than built by introspecting the model classes
+@property (class, nonatomic, readonly) BOOL sharedSchemaWasReadFromManifest;
+
+// Write a manifest of the object schemas in the given schema to the url
++ (BOOL)writeManifestForSchema:(RLMSchema *)schema toURL:(NSURL *)url;
+
+// Read the object schemas from a manifest. Returns nil if the file is missing,
+// malformed, or was written by a different build of the app.
++ (nullable NSArray<RLMObjectSchema *> *)objectSchemaFromManifestAtURL:(NSURL *)url;
+
+// The number of times a key path in a query was and was not found in the cache
+// of key paths resolved against this schema
+@property (nonatomic, readonly) NSUInteger keyPathCacheHits;
+@property (nonatomic, readonly) NSUInteger keyPathCacheMisses;
+
 @end
 
 RLM_HEADER_AUDIT_END(nullability)
@@ -24,14 +24,23 @@ namespace realm {
     class Schema;
     class ObjectSchema;
 }
+class RLMKeyPathCache;
 
 RLM_DIRECT_MEMBERS
 @interface RLMSchema ()
 + (instancetype)dynamicSchemaFromObjectStoreSchema:(realm::Schema const&)objectStoreSchema;
 - (realm::Schema)objectStoreCopy;
+
+// Key paths used in queries which have been resolved against this schema
+- (RLMKeyPathCache&)keyPathCache;
 @end
 
 // Ensure that all objectSchema in the given schema have managed accessors created.
 // This is normally done during schema discovery but may not be when using
-// dynamically created schemas.
+// dynamically created schemas. If accessors are created lazily, this instead
+// marks them as pending.
 void RLMSchemaEnsureAccessorsCreated(RLMSchema *schema);
+
+// Create the accessor classes for an object schema whose accessors are pending.
+// Called the first time either of its accessor classes is read.
+void RLMSchemaCreatePendingAccessors(RLMObjectSchema *objectSchema);
@@ -918,4 +918,70 @@ RLM_HEADER_AUDIT_BEGIN(nullability, sendability)
                                          queue:(nullable dispatch_queue_t)queue __attribute__((warn_unused_result));
 @end
 
+/**
+ Built-in section keys for use with `sectionedResultsSortedUsingKeyPath:ascending:keyBlock:`
+ and `sectionedResultsUsingSortDescriptors:keyBlock:`.
+
+ Each method returns a key block which can be passed anywhere a
+ `RLMSectionedResultsKeyBlock` is accepted. When used to section a managed
+ collection, the section keys are computed directly from the stored values
+ without creating an object for each element or calling a block, which is
+ significantly faster than a custom key block for large collections.
+
+     RLMSectionedResults *sections =
+        [contacts sectionedResultsSortedUsingKeyPath:@"name"
+                                           ascending:YES
+                                            keyBlock:[RLMSectionKey firstCharacterOfProperty:@"name"]];
+ */
+RLM_SWIFT_SENDABLE RLM_FINAL // immutable final class
+@interface RLMSectionKey : NSObject
+
+/**
+ Sections elements by the value of the given property.
+
+ @param property The name of the property to section on, or `self` to section
+                 a collection of primitive values on the values themselves.
+ */
++ (RLMSectionedResultsKeyBlock)valueOfProperty:(NSString *)property;
+
+/**
+ Sections elements by the first character of the given string property. `nil`
+ values produce a `nil` section key and empty strings produce an empty key.
+
+ @param property The name of a string property, or `self` for a collection of strings.
+ */
++ (RLMSectionedResultsKeyBlock)firstCharacterOfProperty:(NSString *)property;
+
+/**
+ Sections elements into ranges of the given integer property. Each section key
+ is the lowest value in its range, so with a bucket size of 10 the values 0-9
+ are in section 0, 10-19 in section 10, and -10 to -1 in section -10.
+
+ @param property   The name of an integer property, or `self` for a collection of integers.
+ @param bucketSize The size of each range. Must be greater than zero.
+ */
++ (RLMSectionedResultsKeyBlock)integerBucketOfProperty:(NSString *)property bucketSize:(int64_t)bucketSize;
+
+/**
+ Sections elements by the calendar period containing the given date property.
+ Each section key is the date at which the period begins in the given time zone
+ in the Gregorian calendar.
+
+ @param property The name of a date property, or `self` for a collection of dates.
+ @param unit     The period to group dates by. Must be one of `NSCalendarUnitYear`,
+                 `NSCalendarUnitMonth`, `NSCalendarUnitDay` or `NSCalendarUnitHour`.
+ @param timeZone The time zone to compute periods in. If `nil`, the default time
+                 zone at the time this method is called is used.
+ */
++ (RLMSectionedResultsKeyBlock)dateBucketOfProperty:(NSString *)property
+                                       calendarUnit:(NSCalendarUnit)unit
+                                           timeZone:(nullable NSTimeZone *)timeZone;
+
+/// :nodoc:
+- (instancetype)init __attribute__((unavailable("RLMSectionKey cannot be created directly")));
+/// :nodoc:
++ (instancetype)new __attribute__((unavailable("RLMSectionKey cannot be created directly")));
+
+@end
+
 RLM_HEADER_AUDIT_END(nullability, sendability)
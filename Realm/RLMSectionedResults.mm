@@ -21,11 +21,15 @@
 #import "RLMCollection_Private.hpp"
 #import "RLMObjectSchema_Private.hpp"
 #import "RLMObservation.hpp"
+#import "RLMProperty_Private.h"
+#import "RLMQueryUtil.hpp"
 #import "RLMRealm_Private.hpp"
 #import "RLMResults.h"
 #import "RLMResults_Private.hpp"
 #import "RLMThreadSafeReference_Private.hpp"
 
+#import <objc/runtime.h>
+
 namespace {
 struct CollectionCallbackWrapper {
     void (^block)(id, RLMSectionedResultsChange *);
@@ -141,14 +145,246 @@ static NSString *indexSetToString(NSIndexSet *sections) {
 
 @end
 
+namespace {
+enum class NativeSectionKeyKind {
+    Value,
+    FirstCharacter,
+    IntegerBucket,
+    DateBucket,
+};
+
+int64_t floorDiv(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+// Conversions between days since 1970-01-01 and proleptic Gregorian dates
+// (see http://howardhinnant.github.io/date_algorithms.html)
+int64_t daysFromCivil(int64_t y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    int64_t era = (y >= 0 ? y : y - 399) / 400;
+    unsigned yoe = static_cast<unsigned>(y - era * 400);
+    unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+void civilFromDays(int64_t z, int64_t& y, unsigned& m) {
+    z += 719468;
+    int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    unsigned doe = static_cast<unsigned>(z - era * 146097);
+    unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    unsigned mp = (5 * doy + 2) / 153;
+    m = mp < 10 ? mp + 3 : mp - 9;
+    y = static_cast<int64_t>(yoe) + era * 400 + (m <= 2);
+}
+
+// A section key which can be computed directly from a stored value. These
+// are created by RLMSectionKey and attached to the key block it returns so
+// that they survive being passed through the public APIs, frozen and thawed.
+struct NativeSectionKey {
+    NativeSectionKeyKind kind;
+    NSString *property;
+    int64_t bucketSize = 0;
+    NSCalendarUnit unit = 0;
+    NSTimeZone *timeZone;
+
+    bool isSelf() const {
+        return [property isEqualToString:@"self"];
+    }
+
+    realm::Mixed operator()(realm::Mixed value) const {
+        if (value.is_null()) {
+            return {};
+        }
+        switch (kind) {
+            case NativeSectionKeyKind::Value:
+                return value;
+            case NativeSectionKeyKind::FirstCharacter: {
+                if (!value.is_type(realm::type_String)) {
+                    return {};
+                }
+                realm::StringData str = value.get_string();
+                if (str.size() == 0) {
+                    return str;
+                }
+                auto lead = static_cast<unsigned char>(str[0]);
+                size_t length = lead < 0xC0 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+                return realm::StringData(str.data(), std::min(length, str.size()));
+            }
+            case NativeSectionKeyKind::IntegerBucket:
+                if (!value.is_type(realm::type_Int)) {
+                    return {};
+                }
+                return realm::Mixed(floorDiv(value.get_int(), bucketSize) * bucketSize);
+            case NativeSectionKeyKind::DateBucket:
+                if (!value.is_type(realm::type_Timestamp)) {
+                    return {};
+                }
+                return dateBucket(value.get_timestamp());
+        }
+        REALM_UNREACHABLE();
+    }
+
+    realm::Timestamp dateBucket(realm::Timestamp ts) const {
+        auto tz = (__bridge CFTimeZoneRef)timeZone;
+        int64_t seconds = ts.get_seconds() - (ts.get_nanoseconds() < 0);
+        auto offset = static_cast<int64_t>(CFTimeZoneGetSecondsFromGMT(tz, seconds - kCFAbsoluteTimeIntervalSince1970));
+        int64_t local = seconds + offset;
+        int64_t start;
+        if (unit == NSCalendarUnitHour) {
+            start = floorDiv(local, 3600) * 3600;
+        }
+        else {
+            int64_t day = floorDiv(local, 86400);
+            if (unit != NSCalendarUnitDay) {
+                int64_t year;
+                unsigned month;
+                civilFromDays(day, year, month);
+                day = daysFromCivil(year, unit == NSCalendarUnitYear ? 1 : month, 1);
+            }
+            start = day * 86400;
+        }
+        // The start of the period may be in a different DST period from the
+        // value, so convert back to UTC with the offset in effect at that time
+        auto startOffset = CFTimeZoneGetSecondsFromGMT(tz, start - offset - kCFAbsoluteTimeIntervalSince1970);
+        return realm::Timestamp(start - static_cast<int64_t>(startOffset), 0);
+    }
+};
+
+char s_nativeSectionKeyTag;
+} // anonymous namespace
+
+@interface RLMNativeSectionKey : NSObject {
+@public
+    NativeSectionKey _key;
+}
+@end
+
+@implementation RLMNativeSectionKey
+@end
+
+static RLMSectionedResultsKeyBlock RLMMakeSectionKeyBlock(NativeSectionKey key) {
+    // The block is used for unmanaged collections and any other code which
+    // calls it directly; managed collections use the attached native key.
+    RLMSectionedResultsKeyBlock block = [^id<RLMValue>(id element) {
+        id value = key.isSelf() ? element : [element valueForKey:key.property];
+        return RLMMixedToObjc(key(RLMObjcToMixed(value)));
+    } copy];
+    RLMNativeSectionKey *holder = [RLMNativeSectionKey new];
+    holder->_key = std::move(key);
+    objc_setAssociatedObject(block, &s_nativeSectionKeyTag, holder, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    return block;
+}
+
+@implementation RLMSectionKey
+
++ (RLMSectionedResultsKeyBlock)valueOfProperty:(NSString *)property {
+    return RLMMakeSectionKeyBlock({.kind = NativeSectionKeyKind::Value, .property = property});
+}
+
++ (RLMSectionedResultsKeyBlock)firstCharacterOfProperty:(NSString *)property {
+    return RLMMakeSectionKeyBlock({.kind = NativeSectionKeyKind::FirstCharacter, .property = property});
+}
+
++ (RLMSectionedResultsKeyBlock)integerBucketOfProperty:(NSString *)property bucketSize:(int64_t)bucketSize {
+    if (bucketSize <= 0) {
+        @throw RLMException(@"Invalid bucket size %lld: must be greater than zero.", bucketSize);
+    }
+    return RLMMakeSectionKeyBlock({.kind = NativeSectionKeyKind::IntegerBucket, .property = property,
+                                   .bucketSize = bucketSize});
+}
+
++ (RLMSectionedResultsKeyBlock)dateBucketOfProperty:(NSString *)property
+                                       calendarUnit:(NSCalendarUnit)unit
+                                           timeZone:(NSTimeZone *)timeZone {
+    if (unit != NSCalendarUnitYear && unit != NSCalendarUnitMonth
+        && unit != NSCalendarUnitDay && unit != NSCalendarUnitHour) {
+        @throw RLMException(@"Invalid calendar unit %lu: must be one of NSCalendarUnitYear, "
+                            @"NSCalendarUnitMonth, NSCalendarUnitDay or NSCalendarUnitHour.",
+                            (unsigned long)unit);
+    }
+    return RLMMakeSectionKeyBlock({.kind = NativeSectionKeyKind::DateBucket, .property = property,
+                                   .unit = unit, .timeZone = timeZone ?: NSTimeZone.defaultTimeZone});
+}
+
+@end
+
+RLMSectionedResults *RLMSectionedResultsByFirstCharacter(id<RLMCollection> collection,
+                                                         NSArray<RLMSortDescriptor *> *sortDescriptors,
+                                                         NSString *property) {
+    return [collection sectionedResultsUsingSortDescriptors:sortDescriptors
+                                                   keyBlock:[RLMSectionKey firstCharacterOfProperty:property]];
+}
+
+static NSString *RLMSectionKeyKindName(NativeSectionKeyKind kind) {
+    switch (kind) {
+        case NativeSectionKeyKind::Value:          return @"value";
+        case NativeSectionKeyKind::FirstCharacter: return @"first character";
+        case NativeSectionKeyKind::IntegerBucket:  return @"integer bucket";
+        case NativeSectionKeyKind::DateBucket:     return @"date bucket";
+    }
+    REALM_UNREACHABLE();
+}
+
+static bool RLMSectionKeySupportsProperty(NativeSectionKeyKind kind, RLMProperty *prop) {
+    if (prop.collection) {
+        return false;
+    }
+    switch (kind) {
+        case NativeSectionKeyKind::Value:
+            return prop.type != RLMPropertyTypeObject && prop.type != RLMPropertyTypeLinkingObjects;
+        case NativeSectionKeyKind::FirstCharacter:
+            return prop.type == RLMPropertyTypeString;
+        case NativeSectionKeyKind::IntegerBucket:
+            return prop.type == RLMPropertyTypeInt;
+        case NativeSectionKeyKind::DateBucket:
+            return prop.type == RLMPropertyTypeDate;
+    }
+    REALM_UNREACHABLE();
+}
+
 struct SectionedResultsKeyProjection {
     RLMClassInfo *_info;
     RLMSectionedResultsKeyBlock _block;
+    // Set if the key block was created by RLMSectionKey, in which case the
+    // keys are computed from the stored values without creating accessors
+    std::optional<NativeSectionKey> _nativeKey;
+    realm::ColKey _column;
+
+    SectionedResultsKeyProjection(RLMClassInfo *info, RLMSectionedResultsKeyBlock block)
+    : _info(info), _block(block) {
+        RLMNativeSectionKey *holder = objc_getAssociatedObject(block, &s_nativeSectionKeyTag);
+        if (!holder) {
+            return;
+        }
+        _nativeKey = holder->_key;
+        if (_nativeKey->isSelf()) {
+            return;
+        }
+        RLMObjectSchema *objectSchema = info->rlmObjectSchema;
+        RLMProperty *prop = RLMValidatedProperty(objectSchema, _nativeKey->property);
+        if (!RLMSectionKeySupportsProperty(_nativeKey->kind, prop)) {
+            @throw RLMException(@"Property '%@.%@' of type '%@' cannot be used as a %@ section key.",
+                                objectSchema.className, prop.name, RLMTypeToString(prop.type),
+                                RLMSectionKeyKindName(_nativeKey->kind));
+        }
+        _column = info->tableColumn(prop);
+    }
 
     realm::Mixed operator()(realm::Mixed obj, realm::SharedRealm) {
-        RLMAccessorContext context(*_info);
-        id value = _block(context.box(obj));
-        return context.unbox<realm::Mixed>(value);
+        if (!_nativeKey) {
+            RLMAccessorContext context(*_info);
+            id value = _block(context.box(obj));
+            return context.unbox<realm::Mixed>(value);
+        }
+        if (!_column) {
+            return (*_nativeKey)(obj);
+        }
+        realm::ObjKey key = obj.is_type(realm::type_TypedLink) ? obj.get_link().get_obj_key()
+                                                                : obj.get<realm::ObjKey>();
+        return (*_nativeKey)(_info->table()->get_object(key).get_any(_column));
     }
 };
 
@@ -157,10 +157,7 @@ static inline NSDate *RLMTimestampToNSDate(realm::Timestamp ts) NS_RETURNS_RETAI
     return [[NSDate alloc] initWithTimeIntervalSinceReferenceDate:timeInterval];
 }
 
-static inline realm::Timestamp RLMTimestampForNSDate(__unsafe_unretained NSDate *const date) {
-    if (!date)
-        return {};
-    auto timeInterval = date.timeIntervalSinceReferenceDate;
+static inline realm::Timestamp RLMTimestampForTimeIntervalSinceReferenceDate(NSTimeInterval timeInterval) {
     if (isnan(timeInterval))
         return {0, 0}; // Arbitrary choice
 
@@ -182,6 +179,12 @@ static inline realm::Timestamp RLMTimestampForNSDate(__unsafe_unretained NSDate
     return {seconds, nanoseconds};
 }
 
+static inline realm::Timestamp RLMTimestampForNSDate(__unsafe_unretained NSDate *const date) {
+    if (!date)
+        return {};
+    return RLMTimestampForTimeIntervalSinceReferenceDate(date.timeIntervalSinceReferenceDate);
+}
+
 static inline NSUInteger RLMConvertNotFound(size_t index) {
     return index == realm::not_found ? NSNotFound : index;
 }
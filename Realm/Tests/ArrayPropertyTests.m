@@ -508,6 +508,100 @@
     [realm commitWriteTransaction];
 }
 
+- (void)testReplaceObjectsInRange {
+    void (^test)(RLMArray *) = ^(RLMArray *array) {
+        StringObject *c = [[StringObject alloc] initWithValue:@[@"c"]];
+        StringObject *d = [[StringObject alloc] initWithValue:@[@"d"]];
+        StringObject *e = [[StringObject alloc] initWithValue:@[@"e"]];
+
+        [array replaceObjectsInRange:NSMakeRange(0, 1) withObjects:@[c]];
+        XCTAssertEqualObjects([array valueForKey:@"stringCol"], (@[@"c", @"b"]));
+
+        [array replaceObjectsInRange:NSMakeRange(1, 1) withObjects:@[d, e]];
+        XCTAssertEqualObjects([array valueForKey:@"stringCol"], (@[@"c", @"d", @"e"]));
+
+        [array replaceObjectsInRange:NSMakeRange(0, 2) withObjects:@[]];
+        XCTAssertEqualObjects([array valueForKey:@"stringCol"], (@[@"e"]));
+
+        [array replaceObjectsInRange:NSMakeRange(1, 0) withObjects:@[c]];
+        XCTAssertEqualObjects([array valueForKey:@"stringCol"], (@[@"e", @"c"]));
+
+        RLMAssertThrowsWithReasonMatching([array replaceObjectsInRange:NSMakeRange(1, 2) withObjects:@[c]],
+                                          @"out of bounds");
+        // Objects are validated before anything is modified
+        RLMAssertThrowsWithReasonMatching(([array replaceObjectsInRange:NSMakeRange(0, 1)
+                                                             withObjects:@[d, [IntObject new]]]),
+                                          @"does not match");
+        XCTAssertEqualObjects([array valueForKey:@"stringCol"], (@[@"e", @"c"]));
+    };
+
+    ArrayPropertyObject *array = [[ArrayPropertyObject alloc] initWithValue:@[@"foo", @[@[@"a"], @[@"b"]], @[]]];
+    test(array.array);
+
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    [realm beginWriteTransaction];
+    array = [ArrayPropertyObject createInRealm:realm withValue:@[@"foo", @[@[@"a"], @[@"b"]], @[]]];
+    test(array.array);
+    [realm commitWriteTransaction];
+}
+
+- (void)testReorderObjects {
+    void (^test)(RLMArray *) = ^(RLMArray *array) {
+        [array reorderObjectsWithIndexes:@[@3, @0, @4, @1, @2]];
+        XCTAssertEqualObjects([array valueForKey:@"stringCol"], (@[@"d", @"a", @"e", @"b", @"c"]));
+
+        [array reorderObjectsWithIndexes:@[@0, @1, @2, @3, @4]];
+        XCTAssertEqualObjects([array valueForKey:@"stringCol"], (@[@"d", @"a", @"e", @"b", @"c"]));
+
+        [array reorderObjectsWithIndexes:@[@1, @3, @4, @0, @2]];
+        XCTAssertEqualObjects([array valueForKey:@"stringCol"], (@[@"a", @"b", @"c", @"d", @"e"]));
+
+        RLMAssertThrowsWithReasonMatching([array reorderObjectsWithIndexes:@[@0, @1]],
+                                          @"requires 5 indexes, but 2 were given");
+        RLMAssertThrowsWithReasonMatching(([array reorderObjectsWithIndexes:@[@0, @1, @2, @3, @5]]),
+                                          @"Index 5 is out of bounds");
+        RLMAssertThrowsWithReasonMatching(([array reorderObjectsWithIndexes:@[@0, @1, @2, @3, @3]]),
+                                          @"Index 3 appears more than once");
+        XCTAssertEqualObjects([array valueForKey:@"stringCol"], (@[@"a", @"b", @"c", @"d", @"e"]));
+    };
+
+    NSArray *values = @[@"foo", @[@[@"a"], @[@"b"], @[@"c"], @[@"d"], @[@"e"]], @[]];
+    ArrayPropertyObject *array = [[ArrayPropertyObject alloc] initWithValue:values];
+    test(array.array);
+
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    [realm beginWriteTransaction];
+    array = [ArrayPropertyObject createInRealm:realm withValue:values];
+    test(array.array);
+    [realm commitWriteTransaction];
+}
+
+- (void)testRemoveObjectsWhere {
+    void (^test)(RLMArray *) = ^(RLMArray *array) {
+        [array addObject:array[0]];
+        [array removeObjectsWhere:@"stringCol IN %@", @[@"a", @"c"]];
+        XCTAssertEqualObjects([array valueForKey:@"stringCol"], (@[@"b", @"d"]));
+
+        [array removeObjectsWithPredicate:[NSPredicate predicateWithFormat:@"stringCol = 'z'"]];
+        XCTAssertEqualObjects([array valueForKey:@"stringCol"], (@[@"b", @"d"]));
+
+        [array removeObjectsWhere:@"TRUEPREDICATE"];
+        XCTAssertEqual(array.count, 0U);
+    };
+
+    NSArray *values = @[@"foo", @[@[@"a"], @[@"b"], @[@"c"], @[@"d"]], @[]];
+    ArrayPropertyObject *array = [[ArrayPropertyObject alloc] initWithValue:values];
+    test(array.array);
+
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    [realm beginWriteTransaction];
+    array = [ArrayPropertyObject createInRealm:realm withValue:values];
+    test(array.array);
+    // Removing objects from the array doesn't delete them
+    XCTAssertEqual([StringObject allObjectsInRealm:realm].count, 4U);
+    [realm commitWriteTransaction];
+}
+
 - (void)testIndexOfObject
 {
     RLMRealm *realm = [RLMRealm defaultRealm];
@@ -914,6 +1008,34 @@
     XCTAssertEqual(3, [[obj.array maxOfProperty:@"propA"] intValue]);
 }
 
+- (void)testPackedPropertyValues {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+
+    CompanyObject *company = [CompanyObject new];
+    XCTAssertEqual(0U, [company.employees int64ValuesOfProperty:@"age"].length);
+    for (NSNumber *age in @[@30, @20, @40]) {
+        [company.employees addObject:[[EmployeeObject alloc] initWithValue:@{@"name": @"Joe", @"age": age}]];
+    }
+
+    int64_t expectedInts[] = {30, 20, 40};
+    double expectedDoubles[] = {30.0, 20.0, 40.0};
+    XCTAssertEqual(0, memcmp([company.employees int64ValuesOfProperty:@"age"].bytes, expectedInts, sizeof(expectedInts)));
+    XCTAssertEqual(0, memcmp([company.employees doubleValuesOfProperty:@"age"].bytes, expectedDoubles, sizeof(expectedDoubles)));
+    RLMAssertThrowsWithReasonMatching([company.employees int64ValuesOfProperty:@"hired"],
+                                      @"int64ValuesOfProperty: is not supported for bool property 'EmployeeObject.hired'");
+
+    [realm transactionWithBlock:^{ [realm addObject:company]; }];
+
+    XCTAssertEqual(0, memcmp([company.employees int64ValuesOfProperty:@"age"].bytes, expectedInts, sizeof(expectedInts)));
+    XCTAssertEqual(0, memcmp([company.employees doubleValuesOfProperty:@"age"].bytes, expectedDoubles, sizeof(expectedDoubles)));
+    RLMAssertThrowsWithReasonMatching([company.employees int64ValuesOfProperty:@"hired"],
+                                      @"int64ValuesOfProperty: is not supported for bool property 'EmployeeObject.hired'");
+
+    [realm transactionWithBlock:^{ [company.employees moveObjectAtIndex:0 toIndex:2]; }];
+    int64_t movedInts[] = {20, 40, 30};
+    XCTAssertEqual(0, memcmp([company.employees int64ValuesOfProperty:@"age"].bytes, movedInts, sizeof(movedInts)));
+}
+
 - (void)testRenamedPropertyObservation {
     RLMRealm *realm = self.realmWithTestPath;
 
@@ -1446,6 +1568,8 @@ static RLMArray<IntObject *> *managedTestArray(void) {
         RLMAssertThrowsWithReasonMatching(array[0] = io, @"thread");
         RLMAssertThrowsWithReasonMatching([array valueForKey:@"intCol"], @"thread");
         RLMAssertThrowsWithReasonMatching([array setValue:@1 forKey:@"intCol"], @"thread");
+        RLMAssertThrowsWithReasonMatching([array int64ValuesOfProperty:@"intCol"], @"thread");
+        RLMAssertThrowsWithReasonMatching([array doubleValuesOfProperty:@"intCol"], @"thread");
         RLMAssertThrowsWithReasonMatching(({for (__unused id obj in array);}), @"thread");
     }];
     [realm cancelWriteTransaction];
@@ -445,6 +445,87 @@
     }];
 }
 
+- (void)testEnumerateKeysAndObjectsAcrossBatches {
+    RLMRealm *realm = self.realmWithTestPath;
+
+    [realm beginWriteTransaction];
+    CompanyObject *company = [CompanyObject createInRealm:realm withValue:@{@"name": @"name"}];
+    const int totalCount = 2500;
+    for (int i = 0; i < totalCount; ++i) {
+        NSString *key = [NSString stringWithFormat:@"item%d", i];
+        company.employeeDict[key] = [EmployeeObject createInRealm:realm withValue:@[key, @(i), @NO]];
+    }
+    [realm commitWriteTransaction];
+
+    __block int count = 0;
+    [company.employeeDict enumerateKeysAndObjectsUsingBlock:^(NSString *key, EmployeeObject *obj, __unused BOOL *stop) {
+        XCTAssertEqualObjects(key, obj.name);
+        ++count;
+    }];
+    XCTAssertEqual(count, totalCount);
+
+    count = 0;
+    [company.employeeDict enumerateKeysAndObjectsUsingBlock:^(__unused id key, __unused id obj, BOOL *stop) {
+        *stop = ++count == 1500;
+    }];
+    XCTAssertEqual(count, 1500);
+}
+
+- (void)testEnumerateKeysAndObjectsWithNestedCollections {
+    RLMRealm *realm = self.realmWithTestPath;
+
+    [realm beginWriteTransaction];
+    MixedObject *obj = [MixedObject createInRealm:realm withValue:@[@{
+        @"int": @1,
+        @"list": @[@2, @3],
+        @"dictionary": @{@"a": @4},
+    }]];
+    [realm commitWriteTransaction];
+
+    RLMDictionary *dictionary = (RLMDictionary *)obj.anyCol;
+    __block int count = 0;
+    [dictionary enumerateKeysAndObjectsUsingBlock:^(NSString *key, id value, __unused BOOL *stop) {
+        ++count;
+        if ([key isEqualToString:@"int"]) {
+            XCTAssertEqualObjects(value, @1);
+        }
+        else if ([key isEqualToString:@"list"]) {
+            XCTAssertTrue([value isKindOfClass:[RLMArray class]]);
+            XCTAssertEqualObjects(value[1], @3);
+        }
+        else {
+            XCTAssertTrue([value isKindOfClass:[RLMDictionary class]]);
+            XCTAssertEqualObjects(value[@"a"], @4);
+        }
+    }];
+    XCTAssertEqual(count, 3);
+}
+
+- (void)testEnumerateKeysAndObjectsWithLinksInMixedDictionary {
+    RLMRealm *realm = self.realmWithTestPath;
+
+    [realm beginWriteTransaction];
+    StringObject *stringObj = [StringObject createInRealm:realm withValue:@[@"a"]];
+    IntObject *intObj = [IntObject createInRealm:realm withValue:@[@1]];
+    MixedObject *obj = [MixedObject createInRealm:realm withValue:@[@{@"string": stringObj, @"int": intObj}]];
+    [realm commitWriteTransaction];
+
+    RLMDictionary *dictionary = (RLMDictionary *)obj.anyCol;
+    __block int count = 0;
+    [dictionary enumerateKeysAndObjectsUsingBlock:^(NSString *key, id value, __unused BOOL *stop) {
+        ++count;
+        if ([key isEqualToString:@"string"]) {
+            XCTAssertTrue([value isKindOfClass:[StringObject class]]);
+            XCTAssertTrue([value isEqualToObject:stringObj]);
+        }
+        else {
+            XCTAssertTrue([value isKindOfClass:[IntObject class]]);
+            XCTAssertTrue([value isEqualToObject:intObj]);
+        }
+    }];
+    XCTAssertEqual(count, 2);
+}
+
 - (void)testDeleteDuringEnumeration {
     RLMRealm *realm = self.realmWithTestPath;
 
@@ -76,4 +76,82 @@
     }
 }
 
+- (void)testEnumerateWithPrefetchWindow
+{
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 100; ++i) {
+        [IntObject createInRealm:realm withValue:@[@(i)]];
+    }
+    [realm commitWriteTransaction];
+
+    RLMResults *all = [IntObject allObjects];
+    for (NSNumber *window in @[@1, @7, @16, @99, @100, @1000]) {
+        int expected = 0;
+        for (IntObject *obj in [all enumeratorWithPrefetchWindow:window.unsignedIntegerValue]) {
+            XCTAssertEqual(obj.intCol, expected++);
+        }
+        XCTAssertEqual(expected, 100);
+    }
+
+    // Enumerating a query uses the same window logic
+    int expected = 50;
+    for (IntObject *obj in [[IntObject objectsWhere:@"intCol >= 50"] enumeratorWithPrefetchWindow:32]) {
+        XCTAssertEqual(obj.intCol, expected++);
+    }
+    XCTAssertEqual(expected, 100);
+
+    // Inside a write transaction the enumerator works on a snapshot, so
+    // deleting the enumerated objects is allowed
+    [realm beginWriteTransaction];
+    NSUInteger count = 0;
+    for (IntObject *obj in [all enumeratorWithPrefetchWindow:10]) {
+        [realm deleteObject:obj];
+        ++count;
+    }
+    [realm commitWriteTransaction];
+    XCTAssertEqual(count, 100U);
+    XCTAssertEqual(all.count, 0U);
+
+    for (__unused IntObject *obj in [all enumeratorWithPrefetchWindow:10]) {
+        XCTFail(@"No objects should remain");
+    }
+
+    RLMAssertThrowsWithReason([all enumeratorWithPrefetchWindow:0],
+                              @"Prefetch window size must be greater than zero.");
+}
+
+- (void)testEnumeratePrefetchWindowEnumeratorTwice
+{
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 50; ++i) {
+        [IntObject createInRealm:realm withValue:@[@(i)]];
+    }
+    [realm commitWriteTransaction];
+
+    id<NSFastEnumeration> enumerator;
+    @autoreleasepool {
+        // The enumerator keeps the results alive after they're released
+        enumerator = [[IntObject allObjects] enumeratorWithPrefetchWindow:8];
+    }
+    for (int pass = 0; pass < 2; ++pass) {
+        int expected = 0;
+        for (IntObject *obj in enumerator) {
+            XCTAssertEqual(obj.intCol, expected++);
+        }
+        XCTAssertEqual(expected, 50);
+    }
+
+    // Each enumeration reflects the current contents of the results
+    [realm transactionWithBlock:^{
+        [IntObject createInRealm:realm withValue:@[@50]];
+    }];
+    int count = 0;
+    for (__unused IntObject *obj in enumerator) {
+        ++count;
+    }
+    XCTAssertEqual(count, 51);
+}
+
 @end
@@ -1464,6 +1464,16 @@ public:
 
         [mutator removeAllObjects];
         AssertIndexChange(NSKeyValueChangeRemoval, [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, 2)]);
+
+        // Bulk operations produce a single change for all of the affected indexes
+        [mutator addObjectsFromArray:@[obj.obj, obj.obj, obj.obj]];
+        AssertIndexChange(NSKeyValueChangeInsertion, [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, 3)]);
+
+        [mutator replaceObjectsInRange:NSMakeRange(1, 2) withObjects:@[obj.obj, obj.obj]];
+        AssertIndexChange(NSKeyValueChangeReplacement, [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(1, 2)]);
+
+        [mutator removeObjectsWhere:@"TRUEPREDICATE"];
+        AssertIndexChange(NSKeyValueChangeRemoval, [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, 3)]);
     }
 }
 
@@ -1808,6 +1818,37 @@ public:
     [realm cancelWriteTransaction];
 }
 
+- (void)testDeleteObjectsInMultipleObservedArrays {
+    KVOLinkObject2 *obj = [self createLinkObject];
+    KVOLinkObject2 *obj2 = [self createLinkObject];
+    KVOLinkObject1 *target1 = obj.obj;
+    KVOLinkObject1 *target2 = obj2.obj;
+    [obj.array addObject:target1];
+    [obj.array addObject:target2];
+    [obj.array addObject:target1];
+    [obj2.array addObject:target2];
+    [obj2.array addObject:target2];
+
+    KVORecorder r1(self, obj, @"array");
+    KVORecorder r2(self, obj2, @"array");
+    KVORecorder r3(self, target1, RLMInvalidatedKey);
+    KVORecorder r4(self, target2, RLMInvalidatedKey);
+    [self.realm deleteObjects:[KVOLinkObject1 allObjectsInRealm:self.realm]];
+
+    AssertChanged(r3, @NO, @YES);
+    AssertChanged(r4, @NO, @YES);
+    if (NSDictionary *note = AssertNotification(r1)) {
+        XCTAssertEqual([note[NSKeyValueChangeKindKey] intValue], static_cast<int>(NSKeyValueChangeRemoval));
+        XCTAssertEqualObjects(note[NSKeyValueChangeIndexesKey], [NSIndexSet indexSetWithIndexesInRange:{0, 3}]);
+    }
+    if (NSDictionary *note = AssertNotification(r2)) {
+        XCTAssertEqual([note[NSKeyValueChangeKindKey] intValue], static_cast<int>(NSKeyValueChangeRemoval));
+        XCTAssertEqualObjects(note[NSKeyValueChangeIndexesKey], [NSIndexSet indexSetWithIndexesInRange:{0, 2}]);
+    }
+    XCTAssertTrue(r1.empty());
+    XCTAssertTrue(r2.empty());
+}
+
 - (void)testObserveInvalidArrayProperty {
     KVOObject *obj = [self createObject];
     XCTAssertThrows([obj.objectArray addObserver:self forKeyPath:@"self" options:0 context:0]);
@@ -2339,6 +2380,30 @@ public:
     AssertChanged(r, @NO, @YES);
 }
 
+- (void)testObserveManyObjectsAndRemoveSome {
+    NSMutableArray *objects = [NSMutableArray new];
+    std::vector<std::unique_ptr<KVORecorder>> recorders;
+    for (int i = 0; i < 20; ++i) {
+        KVOObject *obj = [self createObject];
+        [objects addObject:obj];
+        recorders.push_back(std::make_unique<KVORecorder>(self, obj, @"int32Col"));
+    }
+
+    // Removing observers from objects in the middle moves the remaining
+    // observed objects around in the table's observed object index
+    for (size_t i = 0; i < recorders.size(); i += 3) {
+        recorders[i].reset();
+    }
+
+    for (size_t i = 0; i < recorders.size(); ++i) {
+        KVOObject *obj = objects[i];
+        obj.int32Col = 10;
+        if (recorders[i]) {
+            AssertChanged(*recorders[i], @2, @10);
+        }
+    }
+}
+
 // The following tests aren't really multiple-accessor-specific, but they're
 // conceptually similar and don't make sense in the multiple realm instances case
 - (void)testCancelWriteTransactionWhileObservingNewObject {
@@ -1290,6 +1290,162 @@
     [realm cancelWriteTransaction];
 }
 
+- (void)testCreateObjectsWithValues {
+    auto realm = RLMRealm.defaultRealm;
+    [realm beginWriteTransaction];
+
+    NSArray<DogObject *> *dogs = (NSArray *)[realm createObjects:DogObject.className
+                                                      withValues:@[@[@"a", @1], @{@"dogName": @"b", @"age": @2}]];
+    XCTAssertEqual(dogs.count, 2U);
+    XCTAssertEqualObjects(dogs[0].dogName, @"a");
+    XCTAssertEqual(dogs[0].age, 1);
+    XCTAssertEqualObjects(dogs[1].dogName, @"b");
+    XCTAssertEqual(dogs[1].age, 2);
+    XCTAssertEqual([DogObject allObjectsInRealm:realm].count, 2U);
+
+    XCTAssertEqual([realm createObjects:DogObject.className withValues:@[]].count, 0U);
+
+    [realm cancelWriteTransaction];
+}
+
+- (void)testCreateObjectsWithValuesReportsProgress {
+    auto realm = RLMRealm.defaultRealm;
+    [realm beginWriteTransaction];
+
+    NSMutableArray *values = [NSMutableArray new];
+    for (int i = 0; i < 25; ++i) {
+        [values addObject:@[@(i)]];
+    }
+
+    NSMutableArray *progress = [NSMutableArray new];
+    [realm createObjects:IntObject.className withValues:values batchSize:10 progress:^(NSUInteger count) {
+        [progress addObject:@(count)];
+    }];
+    XCTAssertEqualObjects(progress, (@[@10, @20, @25]));
+    XCTAssertEqual([IntObject allObjectsInRealm:realm].count, 25U);
+    XCTAssertEqual([[IntObject allObjectsInRealm:realm] sumOfProperty:@"intCol"].intValue, 300);
+
+    [progress removeAllObjects];
+    [realm createObjects:IntObject.className withValues:[values subarrayWithRange:NSMakeRange(0, 20)]
+               batchSize:10 progress:^(NSUInteger count) {
+        [progress addObject:@(count)];
+    }];
+    XCTAssertEqualObjects(progress, (@[@10, @20]));
+
+    [progress removeAllObjects];
+    [realm createObjects:IntObject.className withValues:values batchSize:0 progress:^(NSUInteger count) {
+        [progress addObject:@(count)];
+    }];
+    XCTAssertEqualObjects(progress, (@[@25]));
+
+    [realm cancelWriteTransaction];
+}
+
+- (void)testCreateObjectsWithInvalidValues {
+    auto realm = RLMRealm.defaultRealm;
+    RLMAssertThrowsWithReason([realm createObjects:DogObject.className withValues:@[@[@"name", @1]]],
+                              @"call beginWriteTransaction");
+
+    [realm beginWriteTransaction];
+    RLMAssertThrowsWithReason(([realm createObjects:DogObject.className
+                                         withValues:@[@[@"name", @1], @[@"name", @"age"]]]),
+                              @"Invalid value 'age' of type '__NSCFConstantString' for 'int' property 'DogObject.age'");
+    RLMAssertThrowsWithReason([realm createObjects:@"NotARealClass" withValues:@[]],
+                              @"Object type 'NotARealClass' is not managed by the Realm");
+    [realm cancelWriteTransaction];
+}
+
+- (void)testCreateObjectsWithColumns {
+    auto realm = RLMRealm.defaultRealm;
+    [realm beginWriteTransaction];
+
+    int64_t ints[] = {1, -2, 3};
+    float floats[] = {1.5f, 2.5f, -3.5f};
+    double doubles[] = {10.25, 20.5, 30.75};
+    bool bools[] = {true, false, true};
+    double dates[] = {0, 1.5, -100};
+    [realm createObjects:AggregateObject.className count:3 withColumns:@{
+        @"intCol": [NSData dataWithBytes:ints length:sizeof(ints)],
+        @"floatCol": [NSData dataWithBytes:floats length:sizeof(floats)],
+        @"doubleCol": [NSData dataWithBytes:doubles length:sizeof(doubles)],
+        @"boolCol": [NSData dataWithBytes:bools length:sizeof(bools)],
+        @"dateCol": [NSData dataWithBytes:dates length:sizeof(dates)],
+    }];
+
+    RLMResults<AggregateObject *> *objects = [AggregateObject allObjectsInRealm:realm];
+    XCTAssertEqual(objects.count, 3U);
+    for (NSUInteger i = 0; i < 3; ++i) {
+        XCTAssertEqual(objects[i].intCol, ints[i]);
+        XCTAssertEqual(objects[i].floatCol, floats[i]);
+        XCTAssertEqual(objects[i].doubleCol, doubles[i]);
+        XCTAssertEqual(objects[i].boolCol, bools[i]);
+        XCTAssertEqualObjects(objects[i].dateCol, [NSDate dateWithTimeIntervalSince1970:dates[i]]);
+        XCTAssertNil(objects[i].anyCol);
+    }
+
+    const char strings[] = "a\0\0primary key";
+    int64_t pkInts[] = {5, 6, 7};
+    [realm createObjects:PrimaryStringObject.className count:3 withColumns:@{
+        @"stringCol": [NSData dataWithBytes:strings length:sizeof(strings)],
+        @"intCol": [NSData dataWithBytes:pkInts length:sizeof(pkInts)],
+    }];
+    XCTAssertEqual([PrimaryStringObject objectInRealm:realm forPrimaryKey:@"a"].intCol, 5);
+    XCTAssertEqual([PrimaryStringObject objectInRealm:realm forPrimaryKey:@""].intCol, 6);
+    XCTAssertEqual([PrimaryStringObject objectInRealm:realm forPrimaryKey:@"primary key"].intCol, 7);
+
+    // Properties without a column use their default value
+    [realm createObjects:PrimaryKeyWithDefault.className count:2 withColumns:@{
+        @"stringCol": [NSData dataWithBytes:"x\0y" length:4],
+    }];
+    XCTAssertEqual([PrimaryKeyWithDefault objectInRealm:realm forPrimaryKey:@"x"].intCol, 10);
+    XCTAssertEqual([PrimaryKeyWithDefault objectInRealm:realm forPrimaryKey:@"y"].intCol, 10);
+
+    [realm createObjects:IntObject.className count:0 withColumns:@{@"intCol": NSData.data}];
+    XCTAssertEqual([IntObject allObjectsInRealm:realm].count, 0U);
+
+    [realm cancelWriteTransaction];
+}
+
+- (void)testCreateObjectsWithInvalidColumns {
+    auto realm = RLMRealm.defaultRealm;
+    int64_t ints[] = {1, 2};
+    NSData *intData = [NSData dataWithBytes:ints length:sizeof(ints)];
+    RLMAssertThrowsWithReason([realm createObjects:IntObject.className count:2 withColumns:@{@"intCol": intData}],
+                              @"call beginWriteTransaction");
+
+    [realm beginWriteTransaction];
+    RLMAssertThrowsWithReason([realm createObjects:IntObject.className count:3 withColumns:@{@"intCol": intData}],
+                              @"Column for property 'IntObject.intCol' has 16 bytes, but 3 values of 8 bytes each were expected.");
+    RLMAssertThrowsWithReason([realm createObjects:IntObject.className count:2 withColumns:@{@"badCol": intData}],
+                              @"Invalid property name 'badCol' for class 'IntObject'.");
+    RLMAssertThrowsWithReason([realm createObjects:IntObject.className count:2 withColumns:@{}],
+                              @"Missing value for property 'IntObject.intCol'");
+    RLMAssertThrowsWithReason(([realm createObjects:StringObject.className count:2
+                                        withColumns:@{@"stringCol": [NSData dataWithBytes:"a\0b" length:3]}]),
+                              @"Column for property 'StringObject.stringCol' must contain exactly 2 NUL-terminated UTF-8 strings.");
+    RLMAssertThrowsWithReason(([realm createObjects:StringObject.className count:1
+                                        withColumns:@{@"stringCol": [NSData dataWithBytes:"a\0b" length:4]}]),
+                              @"Column for property 'StringObject.stringCol' must contain exactly 1 NUL-terminated UTF-8 strings.");
+    RLMAssertThrowsWithReason(([realm createObjects:StringObject.className count:2
+                                        withColumns:@{@"stringCol": [NSData dataWithBytes:"a\0\xff\xfe" length:5]}]),
+                              @"Column for property 'StringObject.stringCol' contains invalid UTF-8 in value 1.");
+    RLMAssertThrowsWithReason(([realm createObjects:StringObject.className count:1
+                                        withColumns:@{@"stringCol": [NSData dataWithBytes:"\xed\xa0\x80" length:4]}]),
+                              @"Column for property 'StringObject.stringCol' contains invalid UTF-8 in value 0.");
+    RLMAssertThrowsWithReason(([realm createObjects:StringObject.className count:1
+                                        withColumns:@{@"stringCol": [NSData dataWithBytes:"\xc0\xaf" length:3]}]),
+                              @"Column for property 'StringObject.stringCol' contains invalid UTF-8 in value 0.");
+    XCTAssertEqual([StringObject allObjectsInRealm:realm].count, 0U);
+    RLMAssertThrowsWithReason(([realm createObjects:BinaryObject.className count:1
+                                        withColumns:@{@"binaryCol": [NSData dataWithBytes:"a" length:1]}]),
+                              @"Property 'BinaryObject.binaryCol' of type 'data' cannot be created from a column.");
+    RLMAssertThrowsWithReason(([realm createObjects:PrimaryStringObject.className count:2
+                                        withColumns:@{@"stringCol": [NSData dataWithBytes:"a\0a" length:4],
+                                                      @"intCol": intData}]),
+                              @"Attempting to create an object of type 'PrimaryStringObject' with an existing primary key value 'a'.");
+    [realm cancelWriteTransaction];
+}
+
 #pragma mark - Create Or Update
 
 - (void)testCreateOrUpdateWithoutPKThrows {
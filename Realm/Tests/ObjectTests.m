@@ -199,6 +199,16 @@ RLM_COLLECTION_TYPE(CycleObject)
 @implementation SubclassDateObject
 @end
 
+@interface StableIdentityObject : RLMObject
+@property int intCol;
+@end
+
+@implementation StableIdentityObject
++ (BOOL)usesStableIdentity {
+    return YES;
+}
+@end
+
 #pragma mark - Tests
 
 @interface ObjectTests : RLMTestCase
@@ -1505,6 +1515,72 @@ static IntObject *managedObject(void) {
     }
 }
 
+- (void)testPrimaryKeyHashingIsUnchangedByAddingToRealm {
+    RLMRealm *realm = RLMRealm.defaultRealm;
+    NSMutableSet *set = [NSMutableSet new];
+    NSMutableArray *objects = [NSMutableArray new];
+    for (int i = 0; i < 100; ++i) {
+        [objects addObject:[[PrimaryStringObject alloc] initWithValue:@[[NSString stringWithFormat:@"%d", i], @(i)]]];
+        [objects addObject:[[PrimaryIntObject alloc] initWithValue:@[@(i)]]];
+        [objects addObject:[[PrimaryNullableIntObject alloc] initWithValue:@[i == 0 ? NSNull.null : @(i)]]];
+    }
+    NSMutableArray *hashes = [NSMutableArray new];
+    for (RLMObject *obj in objects) {
+        [hashes addObject:@(obj.hash)];
+    }
+    [set addObjectsFromArray:objects];
+
+    [realm transactionWithBlock:^{
+        [realm addObjects:objects];
+    }];
+    for (NSUInteger i = 0; i < objects.count; ++i) {
+        XCTAssertEqual([objects[i] hash], [hashes[i] unsignedIntegerValue]);
+        XCTAssertTrue([set containsObject:objects[i]]);
+    }
+
+    // Separate accessors for the same object are found by their primary key
+    for (PrimaryStringObject *obj in [PrimaryStringObject allObjectsInRealm:realm]) {
+        XCTAssertTrue([set containsObject:obj]);
+    }
+    for (PrimaryNullableIntObject *obj in [PrimaryNullableIntObject allObjectsInRealm:realm]) {
+        XCTAssertTrue([set containsObject:obj]);
+    }
+}
+
+- (void)testStableIdentityHashing {
+    RLMRealm *realm = RLMRealm.defaultRealm;
+    [realm transactionWithBlock:^{
+        for (int i = 0; i < 200; ++i) {
+            [StableIdentityObject createInRealm:realm withValue:@[@(i)]];
+            [IntObject createInRealm:realm withValue:@[@(i)]];
+        }
+    }];
+
+    NSMutableSet *set = [NSMutableSet new];
+    RLMResults<StableIdentityObject *> *allObjects = [StableIdentityObject allObjectsInRealm:realm];
+    for (int i = 0; i < 100; ++i) {
+        [set addObject:allObjects[i]];
+        [set addObject:[IntObject allObjectsInRealm:realm][i]];
+    }
+
+    // Live accessors for the same object are equal even without a primary key
+    for (StableIdentityObject *obj in allObjects) {
+        XCTAssertEqual([set containsObject:obj], obj.intCol < 100);
+    }
+    XCTAssertEqualObjects(allObjects[0], allObjects[0]);
+    XCTAssertEqual(allObjects[0].hash, allObjects[0].hash);
+    XCTAssertNotEqualObjects(allObjects[0], allObjects[1]);
+
+    // Other types without a primary key still use pointer identity
+    for (IntObject *obj in [IntObject allObjectsInRealm:realm]) {
+        XCTAssertFalse([set containsObject:obj]);
+    }
+
+    // Unmanaged objects still use pointer identity
+    StableIdentityObject *unmanaged = [[StableIdentityObject alloc] initWithValue:@[@0]];
+    XCTAssertNotEqualObjects(unmanaged, [[StableIdentityObject alloc] initWithValue:@[@0]]);
+}
+
 - (void)testFreezeInsideWriteTransaction {
     RLMRealm *realm = RLMRealm.defaultRealm;
     [realm beginWriteTransaction];
@@ -1597,4 +1673,84 @@ static IntObject *managedObject(void) {
     XCTAssertEqual([[IntObject allObjects] count], 1);
 }
 
+- (void)testFreezeObjects {
+    RLMRealm *realm = RLMRealm.defaultRealm;
+    __block NSMutableArray *objects = [NSMutableArray new];
+    [realm transactionWithBlock:^{
+        for (int i = 0; i < 10; ++i) {
+            [objects addObject:[IntObject createInRealm:realm withValue:@[@(i)]]];
+            [objects addObject:[StringObject createInRealm:realm withValue:@[@(i).stringValue]]];
+        }
+    }];
+
+    NSArray *frozen = [realm freezeObjects:objects];
+    XCTAssertEqual(frozen.count, objects.count);
+    for (NSUInteger i = 0; i < frozen.count; ++i) {
+        XCTAssertTrue([frozen[i] isFrozen]);
+        XCTAssertEqual([frozen[i] realm], realm.freeze);
+        XCTAssertEqual([frozen[i] class], [objects[i] class]);
+        XCTAssertEqualObjects(frozen[i], [objects[i] freeze]);
+    }
+    XCTAssertEqual([frozen[2] intCol], 1);
+    XCTAssertEqualObjects([frozen[3] stringCol], @"1");
+
+    // Freezing frozen objects returns them unchanged
+    NSArray *refrozen = [realm.freeze freezeObjects:frozen];
+    for (NSUInteger i = 0; i < frozen.count; ++i) {
+        XCTAssertEqual(refrozen[i], frozen[i]);
+    }
+
+    [realm transactionWithBlock:^{
+        [objects[0] setIntCol:100];
+    }];
+    XCTAssertEqual([frozen[0] intCol], 0);
+    XCTAssertEqual([realm freezeObjects:@[]].count, 0U);
+}
+
+- (void)testFreezeObjectsValidation {
+    RLMRealm *realm = RLMRealm.defaultRealm;
+    IntObject *obj = managedObject();
+    RLMAssertThrowsWithReason([realm freezeObjects:@[obj, [[IntObject alloc] init]]],
+                              @"Unmanaged objects cannot be frozen.");
+    RLMAssertThrowsWithReason([realm freezeObjects:@[obj, @1]],
+                              @"Cannot freeze object of type");
+    RLMAssertThrowsWithReason([realm.freeze freezeObjects:@[obj]],
+                              @"Cannot freeze an object managed by a different Realm.");
+
+    [realm beginWriteTransaction];
+    IntObject *created = [IntObject createInRealm:realm withValue:@[@1]];
+    RLMAssertThrowsWithReason([realm freezeObjects:@[obj, created]],
+                              @"Cannot freeze an object in the same write transaction as it was created in.");
+    [realm cancelWriteTransaction];
+
+    [self dispatchAsyncAndWait:^{
+        RLMAssertThrowsWithReason([realm freezeObjects:@[obj]],
+                                  @"Realm accessed from incorrect thread");
+    }];
+}
+
+- (void)testThawObjects {
+    RLMRealm *realm = RLMRealm.defaultRealm;
+    NSArray *objects = @[managedObject(), managedObject(), managedObject()];
+    NSArray *frozen = [realm freezeObjects:objects];
+
+    [realm transactionWithBlock:^{
+        [objects[0] setIntCol:5];
+        [realm deleteObject:objects[1]];
+    }];
+
+    RLMRealm *frozenRealm = [frozen[0] realm];
+    NSArray *thawed = [frozenRealm thawObjects:frozen];
+    XCTAssertEqual(thawed.count, 3U);
+    XCTAssertFalse([thawed[0] isFrozen]);
+    XCTAssertEqual([thawed[0] intCol], 5);
+    XCTAssertEqual(thawed[1], NSNull.null);
+    XCTAssertTrue([thawed[2] isEqualToObject:objects[2]]);
+
+    // Thawing live objects returns them unchanged
+    XCTAssertEqual([realm thawObjects:@[objects[0]]][0], objects[0]);
+    RLMAssertThrowsWithReason([frozenRealm thawObjects:@[objects[0]]],
+                              @"Cannot thaw an object managed by a different Realm.");
+}
+
 @end
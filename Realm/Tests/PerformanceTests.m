@@ -127,6 +127,60 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
     }];
 }
 
+- (void)testInsertMultipleLiteralBatched {
+    NSMutableArray *values = [NSMutableArray arrayWithCapacity:500000];
+    for (int i = 0; i < 500000; ++i) {
+        [values addObject:@[@"a"]];
+    }
+    [self measureBlock:^{
+        RLMRealm *realm = self.realmWithTestPath;
+        [realm beginWriteTransaction];
+        [realm createObjects:StringObject.className withValues:values batchSize:0 progress:nil];
+        [realm commitWriteTransaction];
+        [self tearDown];
+    }];
+}
+
+- (void)testInsertMultipleBoxedValues {
+    [self measureBlock:^{
+        RLMRealm *realm = self.realmWithTestPath;
+        [realm beginWriteTransaction];
+        for (int i = 0; i < 200000; ++i) {
+            [realm createObject:AggregateObject.className
+                      withValue:@[@(i), @(i * 0.5f), @(i * 0.25), @(i % 2 == 0),
+                                  [NSDate dateWithTimeIntervalSince1970:i]]];
+        }
+        [realm commitWriteTransaction];
+        [self tearDown];
+    }];
+}
+
+- (void)testInsertMultipleFromColumns {
+    const NSUInteger count = 200000;
+    NSMutableData *ints = [NSMutableData dataWithLength:count * sizeof(int64_t)];
+    NSMutableData *floats = [NSMutableData dataWithLength:count * sizeof(float)];
+    NSMutableData *doubles = [NSMutableData dataWithLength:count * sizeof(double)];
+    NSMutableData *bools = [NSMutableData dataWithLength:count * sizeof(bool)];
+    NSMutableData *dates = [NSMutableData dataWithLength:count * sizeof(double)];
+    for (NSUInteger i = 0; i < count; ++i) {
+        ((int64_t *)ints.mutableBytes)[i] = i;
+        ((float *)floats.mutableBytes)[i] = i * 0.5f;
+        ((double *)doubles.mutableBytes)[i] = i * 0.25;
+        ((bool *)bools.mutableBytes)[i] = i % 2 == 0;
+        ((double *)dates.mutableBytes)[i] = i;
+    }
+    NSDictionary *columns = @{@"intCol": ints, @"floatCol": floats, @"doubleCol": doubles,
+                              @"boolCol": bools, @"dateCol": dates};
+
+    [self measureBlock:^{
+        RLMRealm *realm = self.realmWithTestPath;
+        [realm beginWriteTransaction];
+        [realm createObjects:AggregateObject.className count:count withColumns:columns];
+        [realm commitWriteTransaction];
+        [self tearDown];
+    }];
+}
+
 - (RLMRealm *)getStringObjects:(int)factor {
     RLMRealmConfiguration *config = [RLMRealmConfiguration new];
     config.inMemoryIdentifier = @(factor).stringValue;
@@ -201,6 +255,28 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
     }];
 }
 
+- (void)testEnumerateAndAccessAllWithPrefetchWindow {
+    RLMRealm *realm = [self getStringObjects:50];
+
+    [self measureBlock:^{
+        RLMResults *all = [StringObject allObjectsInRealm:realm];
+        for (StringObject *so in [all enumeratorWithPrefetchWindow:1024]) {
+            (void)[so stringCol];
+        }
+    }];
+}
+
+- (void)testEnumerateAndAccessQueryWithPrefetchWindow {
+    RLMRealm *realm = [self getStringObjects:50];
+
+    [self measureBlock:^{
+        RLMResults *results = [StringObject objectsInRealm:realm where:@"stringCol = 'a'"];
+        for (StringObject *so in [results enumeratorWithPrefetchWindow:1024]) {
+            (void)[so stringCol];
+        }
+    }];
+}
+
 - (void)testEnumerateAndAccessArrayProperty {
     RLMRealm *realm = [self getStringObjects:50];
 
@@ -319,6 +395,30 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
     }];
 }
 
+- (void)testRepeatedParameterizedQueryConstruction {
+    RLMRealm *realm = self.realmWithTestPath;
+
+    [self measureBlock:^{
+        for (int i = 0; i < 5000; ++i) {
+            [LinkToAllTypesObject objectsInRealm:realm
+                                           where:@"allTypesCol.intCol = %d and allTypesCol.stringCol = %@ and allTypesCol.doubleCol > %f",
+                                                 i, @(i).stringValue, i * 0.5];
+        }
+    }];
+}
+
+- (void)testRepeatedPreparedQueryConstruction {
+    RLMRealm *realm = self.realmWithTestPath;
+    RLMPreparedQuery *query = [RLMPreparedQuery queryWithClassName:LinkToAllTypesObject.className
+                                                             where:@"allTypesCol.intCol = %@ and allTypesCol.stringCol = %@ and allTypesCol.doubleCol > %@"];
+
+    [self measureBlock:^{
+        for (int i = 0; i < 5000; ++i) {
+            [query resultsInRealm:realm arguments:@[@(i), @(i).stringValue, @(i * 0.5)]];
+        }
+    }];
+}
+
 - (void)testDeleteAll {
     [self measureMetrics:self.class.defaultPerformanceMetrics automaticallyStartMeasuring:NO forBlock:^{
         RLMRealm *realm = [self getStringObjects:50];
@@ -420,6 +520,174 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
     }];
 }
 
+- (void)testAggregateOverLinkProperty {
+    RLMRealm *realm = self.realmWithTestPath;
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 100000; ++i) {
+        [OwnerObject createInRealm:realm withValue:@[@"owner", @[@"dog", @(i % 20)]]];
+    }
+    [realm commitWriteTransaction];
+
+    RLMResults *owners = [OwnerObject allObjectsInRealm:realm];
+    [self measureBlock:^{
+        (void)[owners sumOfProperty:@"dog.age"];
+        (void)[owners averageOfProperty:@"dog.age"];
+        (void)[owners minOfProperty:@"dog.age"];
+        (void)[owners maxOfProperty:@"dog.age"];
+    }];
+}
+
+- (void)testAggregateOverPrimitiveList {
+    RLMRealm *realm = self.realmWithTestPath;
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 100000; ++i) {
+        [AllPrimitiveArrays createInRealm:realm withValue:@{@"intObj": @[@(i), @(i + 1), @(i + 2)]}];
+    }
+    [realm commitWriteTransaction];
+
+    RLMResults *results = [AllPrimitiveArrays allObjectsInRealm:realm];
+    [self measureBlock:^{
+        (void)[results valueForKeyPath:@"@sum.intObj"];
+        (void)[results valueForKeyPath:@"@avg.intObj"];
+        (void)[results valueForKeyPath:@"@min.intObj"];
+        (void)[results valueForKeyPath:@"@max.intObj"];
+    }];
+}
+
+- (void)testReadPropertyValuesWithValueForKey {
+    RLMRealm *realm = self.realmWithTestPath;
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 100000; ++i) {
+        [AggregateObject createInRealm:realm withValue:@[@(i), @0.0f, @(i * 0.5), @NO, NSDate.date]];
+    }
+    [realm commitWriteTransaction];
+
+    RLMResults *results = [AggregateObject allObjectsInRealm:realm];
+    [self measureBlock:^{
+        (void)[results valueForKey:@"intCol"];
+        (void)[results valueForKey:@"doubleCol"];
+    }];
+}
+
+- (void)testReadPackedPropertyValues {
+    RLMRealm *realm = self.realmWithTestPath;
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 100000; ++i) {
+        [AggregateObject createInRealm:realm withValue:@[@(i), @0.0f, @(i * 0.5), @NO, NSDate.date]];
+    }
+    [realm commitWriteTransaction];
+
+    RLMResults *results = [AggregateObject allObjectsInRealm:realm];
+    [self measureBlock:^{
+        (void)[results int64ValuesOfProperty:@"intCol"];
+        (void)[results doubleValuesOfProperty:@"doubleCol"];
+    }];
+}
+
+- (NSArray *)objectsToFreeze {
+    RLMRealm *realm = self.realmWithTestPath;
+    NSMutableArray *objects = [NSMutableArray new];
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 10000; ++i) {
+        [objects addObject:[IntObject createInRealm:realm withValue:@[@(i)]]];
+    }
+    [realm commitWriteTransaction];
+    return objects;
+}
+
+- (void)testFreezeObjectsIndividually {
+    NSArray *objects = [self objectsToFreeze];
+    [self measureBlock:^{
+        @autoreleasepool {
+            for (IntObject *obj in objects) {
+                (void)[obj freeze];
+            }
+        }
+    }];
+}
+
+- (void)testFreezeObjectsInBatch {
+    NSArray *objects = [self objectsToFreeze];
+    RLMRealm *realm = self.realmWithTestPath;
+    [self measureBlock:^{
+        @autoreleasepool {
+            (void)[realm freezeObjects:objects];
+        }
+    }];
+}
+
+- (void)testThawObjectsIndividually {
+    RLMRealm *realm = self.realmWithTestPath;
+    NSArray *frozen = [realm freezeObjects:[self objectsToFreeze]];
+    [self measureBlock:^{
+        @autoreleasepool {
+            for (IntObject *obj in frozen) {
+                (void)[obj thaw];
+            }
+        }
+    }];
+}
+
+- (void)testThawObjectsInBatch {
+    RLMRealm *realm = self.realmWithTestPath;
+    NSArray *frozen = [realm freezeObjects:[self objectsToFreeze]];
+    RLMRealm *frozenRealm = [frozen.firstObject realm];
+    [self measureBlock:^{
+        @autoreleasepool {
+            (void)[frozenRealm thawObjects:frozen];
+        }
+    }];
+}
+
+- (void)testHashManagedPrimaryKeyObjects {
+    RLMRealm *realm = self.realmWithTestPath;
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 10000; ++i) {
+        [PrimaryStringObject createInRealm:realm withValue:@[[NSString stringWithFormat:@"object %d", i], @(i)]];
+    }
+    [realm commitWriteTransaction];
+    NSMutableArray *objects = [NSMutableArray new];
+    for (PrimaryStringObject *obj in [PrimaryStringObject allObjectsInRealm:realm]) {
+        [objects addObject:obj];
+    }
+
+    [self measureBlock:^{
+        @autoreleasepool {
+            (void)[NSSet setWithArray:objects];
+        }
+    }];
+}
+
+- (RLMRealm *)realmWithContactNames {
+    RLMRealm *realm = self.realmWithTestPath;
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 200000; ++i) {
+        [StringObject createInRealm:realm withValue:@[[NSString stringWithFormat:@"%c contact %d", 'a' + arc4random_uniform(26), i]]];
+    }
+    [realm commitWriteTransaction];
+    return realm;
+}
+
+- (void)testSectionByFirstCharacterWithKeyBlock {
+    RLMResults *results = [StringObject allObjectsInRealm:[self realmWithContactNames]];
+    [self measureBlock:^{
+        RLMSectionedResults *sr = [results sectionedResultsSortedUsingKeyPath:@"stringCol" ascending:YES
+                                                                      keyBlock:^id<RLMValue>(StringObject *obj) {
+            return [obj.stringCol substringToIndex:1];
+        }];
+        (void)sr.count;
+    }];
+}
+
+- (void)testSectionByFirstCharacterWithSectionKey {
+    RLMResults *results = [StringObject allObjectsInRealm:[self realmWithContactNames]];
+    [self measureBlock:^{
+        RLMSectionedResults *sr = [results sectionedResultsSortedUsingKeyPath:@"stringCol" ascending:YES
+                                                                      keyBlock:[RLMSectionKey firstCharacterOfProperty:@"stringCol"]];
+        (void)sr.count;
+    }];
+}
+
 - (void)testRealmCreationCached {
     __block RLMRealm *realm;
     [self dispatchAsyncAndWait:^{
@@ -436,6 +704,27 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
     [realm configuration];
 }
 
+- (void)testRealmCreationCachedConcurrently {
+    __block RLMRealm *realm;
+    [self dispatchAsyncAndWait:^{
+        realm = [self realmWithTestPath];
+    }];
+
+    [self measureBlock:^{
+        dispatch_apply(8, DISPATCH_APPLY_AUTO, ^(size_t) {
+            // Keep a Realm open on this thread so that the opens below are cache hits
+            RLMRealm *threadRealm = [self realmWithTestPath];
+            for (int i = 0; i < 1000; ++i) {
+                @autoreleasepool {
+                    [self realmWithTestPath];
+                }
+            }
+            [threadRealm configuration];
+        });
+    }];
+    [realm configuration];
+}
+
 - (void)testRealmCreationUncached {
     [self measureBlock:^{
         for (int i = 0; i < 500; ++i) {
@@ -461,6 +750,27 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
     }];
 }
 
+- (void)testRealmFileCreationConcurrently {
+    // Opens a distinct file on each thread, as an app which opens a Realm
+    // per account at launch would
+    const size_t threadCount = 12;
+    const int filesPerThread = 10;
+    __block int measurement = 0;
+    [self measureBlock:^{
+        size_t base = measurement++ * threadCount * filesPerThread;
+        dispatch_apply(threadCount, DISPATCH_APPLY_AUTO, ^(size_t thread) {
+            RLMRealmConfiguration *config = [RLMRealmConfiguration new];
+            for (int i = 0; i < filesPerThread; ++i) {
+                @autoreleasepool {
+                    config.inMemoryIdentifier = [NSString stringWithFormat:@"concurrent %zu",
+                                                 base + thread * filesPerThread + i];
+                    [RLMRealm realmWithConfiguration:config error:nil];
+                }
+            }
+        });
+    }];
+}
+
 - (void)testInvalidateRefresh {
     RLMRealm *realm = [self testRealm];
     [self measureBlock:^{
@@ -920,6 +1230,75 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
     }];
 }
 
+- (void)testWriteWithManyKVOObservedObjects {
+    RLMRealm *realm = self.realmWithTestPath;
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 10000; ++i) {
+        [IntObject createInRealm:realm withValue:@[@(i)]];
+    }
+    [realm commitWriteTransaction];
+
+    NSMutableArray *observed = [NSMutableArray new];
+    for (IntObject *obj in [IntObject allObjectsInRealm:realm]) {
+        [obj addObserver:self forKeyPath:@"intCol" options:(NSKeyValueObservingOptions)0 context:nil];
+        [observed addObject:obj];
+    }
+
+    RLMResults *all = [IntObject allObjectsInRealm:realm];
+    [self measureBlock:^{
+        // Write via accessors which are not themselves observed so that each
+        // write has to look up the observation info for the row
+        for (NSUInteger i = 0; i < 1000; ++i) {
+            [realm beginWriteTransaction];
+            IntObject *obj = all[(i * 7919) % all.count];
+            obj.intCol++;
+            [realm commitWriteTransaction];
+        }
+    }];
+
+    for (IntObject *obj in observed) {
+        [obj removeObserver:self forKeyPath:@"intCol" context:nil];
+    }
+}
+
+- (void)testDeleteObjectGraphWithKVOObservers {
+    RLMRealm *realm = self.realmWithTestPath;
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 1000; ++i) {
+        ArrayPropertyObject *parent = [ArrayPropertyObject createInRealm:realm withValue:@[@"", @[], @[]]];
+        for (int j = 0; j < 100; ++j) {
+            [parent.intArray addObject:[IntObject createInRealm:realm withValue:@[@(j)]]];
+        }
+    }
+    [realm commitWriteTransaction];
+
+    // Observe every list which has objects removed from it, and every tenth
+    // object which is deleted
+    NSMutableArray *observed = [NSMutableArray new];
+    for (ArrayPropertyObject *parent in [ArrayPropertyObject allObjectsInRealm:realm]) {
+        [parent addObserver:self forKeyPath:@"intArray" options:(NSKeyValueObservingOptions)0 context:nil];
+        [observed addObject:@[parent, @"intArray"]];
+    }
+    RLMResults *targets = [IntObject allObjectsInRealm:realm];
+    for (NSUInteger i = 0; i < targets.count; i += 10) {
+        IntObject *obj = targets[i];
+        [obj addObserver:self forKeyPath:@"invalidated" options:(NSKeyValueObservingOptions)0 context:nil];
+        [observed addObject:@[obj, @"invalidated"]];
+    }
+
+    [self measureMetrics:self.class.defaultPerformanceMetrics automaticallyStartMeasuring:NO forBlock:^{
+        [realm beginWriteTransaction];
+        [self startMeasuring];
+        [realm deleteObjects:[IntObject allObjectsInRealm:realm]];
+        [self stopMeasuring];
+        [realm cancelWriteTransaction];
+    }];
+
+    for (NSArray *pair in observed) {
+        [pair[0] removeObserver:self forKeyPath:pair[1] context:nil];
+    }
+}
+
 - (void)observeObject:(RLMObject *)object keyPath:(NSString *)keyPath until:(int (^)(id))block {
     self.sema = dispatch_semaphore_create(0);
     self.queue = dispatch_queue_create("bg", 0);
@@ -945,7 +1324,9 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
                       ofObject:(__unused id)object
                         change:(__unused NSDictionary *)change
                        context:(void *)context {
-    dispatch_semaphore_signal((__bridge dispatch_semaphore_t)context);
+    if (context) {
+        dispatch_semaphore_signal((__bridge dispatch_semaphore_t)context);
+    }
 }
 
 @end
@@ -413,6 +413,32 @@
     RLMAssertThrowsWithReasonMatching([LinkToAllTypesObject objectsWhere:@"allTypesCol.intCol = allTypesCol.doubleCol"], @"Property type mismatch");
 }
 
+- (void)testKeyPathCacheReusesResolvedKeyPaths {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    RLMSchema *schema = realm.schema;
+
+    [LinkToAllTypesObject objectsInRealm:realm where:@"allTypesCol.intCol = %d", 0];
+    NSUInteger hits = schema.keyPathCacheHits, misses = schema.keyPathCacheMisses;
+
+    for (int i = 0; i < 5; ++i) {
+        [LinkToAllTypesObject objectsInRealm:realm where:@"allTypesCol.intCol = %d", i];
+    }
+    XCTAssertEqual(schema.keyPathCacheHits, hits + 5);
+    XCTAssertEqual(schema.keyPathCacheMisses, misses);
+
+    [LinkToAllTypesObject objectsInRealm:realm where:@"allTypesCol.intCol > 2 AND allTypesCol.intCol < 10"];
+    XCTAssertEqual(schema.keyPathCacheHits, hits + 7);
+    XCTAssertEqual(schema.keyPathCacheMisses, misses);
+
+    // Invalid key paths are not cached and continue to throw
+    for (int i = 0; i < 2; ++i) {
+        RLMAssertThrowsWithReasonMatching([LinkToAllTypesObject objectsInRealm:realm where:@"allTypesCol.invalidCol = 1"],
+                                          @"Property 'invalidCol' not found");
+    }
+    XCTAssertEqual(schema.keyPathCacheHits, hits + 7);
+    XCTAssertEqual(schema.keyPathCacheMisses, misses + 2);
+}
+
 - (void)testNumericOperatorsOnClass:(Class)class property:(NSString *)property value:(id)value {
     NSArray *operators = @[@"<", @"<=", @">", @">=", @"==", @"!="];
     for (NSString *operator in operators) {
@@ -487,6 +513,49 @@
     XCTAssertEqualObjects([results[0] name], @"Tim", @"Tim should be first results");
 }
 
+- (void)testPreparedQuery {
+    RLMRealm *realm = [self realm];
+
+    [realm beginWriteTransaction];
+    [PersonObject createInRealm:realm withValue:@[@"Fiel", @27]];
+    [PersonObject createInRealm:realm withValue:@[@"Ari", @33]];
+    [PersonObject createInRealm:realm withValue:@[@"Tim", @29]];
+    [realm commitWriteTransaction];
+
+    RLMPreparedQuery *query = [RLMPreparedQuery queryWithClassName:PersonObject.className
+                                                             where:@"age > %@ AND name != %@ AND name != '100%%'"];
+    XCTAssertEqual(query.argumentCount, 2U);
+    XCTAssertEqual([query resultsInRealm:realm arguments:@[@28, @"Ari"]].count, 1U);
+    XCTAssertEqual([query resultsInRealm:realm arguments:@[@20, @"Ari"]].count, 2U);
+    XCTAssertEqual([query resultsInRealm:realm arguments:@[@40, @"Ari"]].count, 0U);
+
+    RLMResults *sorted = [[PersonObject allObjectsInRealm:realm] sortedResultsUsingKeyPath:@"age" ascending:YES];
+    RLMResults *results = [query resultsFromResults:sorted arguments:@[@20, @"Tim"]];
+    XCTAssertEqual(results.count, 2U);
+    XCTAssertEqualObjects([results[0] name], @"Fiel");
+    XCTAssertEqualObjects([results[1] name], @"Ari");
+
+    // Arguments inside aggregates and collection arguments to IN are replaced
+    query = [RLMPreparedQuery queryWithClassName:PersonObject.className
+                                           where:@"age BETWEEN {%@, %@} OR name IN %@"];
+    XCTAssertEqual(query.argumentCount, 3U);
+    XCTAssertEqual([query resultsInRealm:realm arguments:@[@28, @30, @[@"Ari"]]].count, 2U);
+    XCTAssertEqual([query resultsInRealm:realm arguments:@[@0, @1, @[]]].count, 0U);
+
+    query = [RLMPreparedQuery queryWithClassName:PersonObject.className where:@"name == %@"];
+    XCTAssertEqual([query resultsInRealm:realm arguments:@[NSNull.null]].count, 0U);
+
+    RLMAssertThrowsWithReason([query resultsInRealm:realm arguments:@[]],
+                              @"Prepared query 'name == %@' requires 1 arguments, but 0 were supplied.");
+    RLMAssertThrowsWithReason([query resultsFromResults:[DogObject allObjectsInRealm:realm] arguments:@[@"a"]],
+                              @"Prepared query for objects of type 'PersonObject' cannot be used on results of type 'DogObject'.");
+    RLMAssertThrowsWithReason([RLMPreparedQuery queryWithClassName:PersonObject.className where:@"%K == %@"],
+                              @"prepared queries only support '%@' format specifiers");
+    RLMAssertThrowsWithReason([[RLMPreparedQuery queryWithClassName:@"NotARealClass" where:@"age > 1"]
+                               resultsInRealm:realm arguments:@[]],
+                              @"Object type 'NotARealClass' is not managed by the Realm");
+}
+
 - (void)testQueryBetween {
     RLMRealm *realm = [self realm];
 
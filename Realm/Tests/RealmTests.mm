@@ -33,6 +33,7 @@
 #import <unordered_set>
 
 #import <realm/util/file.hpp>
+#import <realm/util/scope_exit.hpp>
 #import <realm/db_options.hpp>
 
 #if !defined(REALM_COCOA_VERSION)
@@ -813,6 +814,23 @@
     [realm cancelWriteTransaction];
 }
 
+- (void)testAddObjectsOfMixedTypes {
+    RLMRealm *realm = [self realmWithTestPath];
+
+    [realm beginWriteTransaction];
+    [realm addObjects:@[[[DogObject alloc] initWithValue:@[@"a", @1]],
+                        [[DogObject alloc] initWithValue:@[@"b", @2]],
+                        [[IntObject alloc] initWithValue:@[@3]],
+                        [[DogObject alloc] initWithValue:@[@"c", @4]]]];
+    XCTAssertEqual(3U, [[DogObject allObjectsInRealm:realm] count]);
+    XCTAssertEqual(1U, [[IntObject allObjectsInRealm:realm] count]);
+
+    RLMAssertThrowsWithReason(([realm addOrUpdateObjects:@[[[PrimaryIntObject alloc] initWithValue:@[@1]],
+                                                           [[IntObject alloc] initWithValue:@[@1]]]]),
+                              @"'IntObject' does not have a primary key and can not be updated");
+    [realm cancelWriteTransaction];
+}
+
 #pragma mark - Transactions
 
 - (void)testRealmTransactionBlock {
@@ -2503,6 +2521,37 @@
     }];
 }
 
+- (void)testOpenDifferentFilesConcurrently {
+    const size_t threadCount = 8;
+    dispatch_apply(threadCount, DISPATCH_APPLY_AUTO, ^(size_t i) {
+        @autoreleasepool {
+            RLMRealmConfiguration *config = [RLMRealmConfiguration new];
+            config.inMemoryIdentifier = [NSString stringWithFormat:@"concurrent open %zu", i];
+            RLMRealm *realm = [RLMRealm realmWithConfiguration:config error:nil];
+            XCTAssertNotNil(realm);
+            [realm transactionWithBlock:^{
+                [IntObject createInRealm:realm withValue:@[@(i)]];
+            }];
+            XCTAssertEqual([IntObject allObjectsInRealm:realm].count, 1U);
+            XCTAssertEqual([[IntObject allObjectsInRealm:realm].firstObject intCol], (int)i);
+        }
+    });
+}
+
+- (void)testOpenSameFileConcurrently {
+    const size_t threadCount = 8;
+    RLMRealmConfiguration *config = [RLMRealmConfiguration defaultConfiguration];
+    dispatch_apply(threadCount, DISPATCH_APPLY_AUTO, ^(size_t) {
+        @autoreleasepool {
+            RLMRealm *realm = [RLMRealm realmWithConfiguration:config error:nil];
+            [realm transactionWithBlock:^{
+                [IntObject createInRealm:realm withValue:@[@0]];
+            }];
+        }
+    });
+    XCTAssertEqual([IntObject allObjectsInRealm:[RLMRealm defaultRealm]].count, threadCount);
+}
+
 #pragma mark - Frozen Realms
 
 - (void)testIsFrozen {
@@ -2553,6 +2602,127 @@
     XCTAssertNotEqual(fr1, fr3);
 }
 
+- (void)testFrozenRealmCacheStatistics {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    RLMFrozenRealmCacheStatistics *stats = realm.frozenRealmCacheStatistics;
+    XCTAssertEqual(stats.frozenVersions, 0U);
+    XCTAssertEqual(stats.hitRate, 0.0);
+
+    RLMRealm *fr1 = realm.freeze;
+    RLMRealm *fr2 = realm.freeze;
+    [realm transactionWithBlock:^{
+        [IntObject createInRealm:realm withValue:@[@1]];
+    }];
+    RLMRealm *fr3 = realm.freeze;
+    RLMRealm *fr4 = realm.freeze;
+    XCTAssertEqual(fr1, fr2);
+    XCTAssertEqual(fr3, fr4);
+
+    stats = realm.frozenRealmCacheStatistics;
+    XCTAssertEqual(stats.frozenVersions, 2U);
+    XCTAssertEqual(stats.pinnedVersions, 0U);
+    XCTAssertEqual(stats.hits, 2U);
+    XCTAssertEqual(stats.misses, 2U);
+    XCTAssertEqual(stats.evictions, 0U);
+    XCTAssertEqual(stats.hitRate, 0.5);
+    XCTAssertGreaterThan(stats.bytesRetainedByOldVersions, 0U);
+}
+
+- (void)testFrozenRealmCacheRetainsRecentVersions {
+    RLMRealm.maximumFrozenVersions = 2;
+    auto reset = realm::util::make_scope_exit([&]() noexcept { RLMRealm.maximumFrozenVersions = 0; });
+
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    __weak RLMRealm *weakFr1, *weakFr2;
+    @autoreleasepool {
+        weakFr1 = realm.freeze;
+        [realm transactionWithBlock:^{ }];
+        weakFr2 = realm.freeze;
+    }
+    // The cache keeps the most recent versions alive even though nothing
+    // else references them
+    XCTAssertNotNil(weakFr1);
+    XCTAssertNotNil(weakFr2);
+    XCTAssertEqual(realm.freeze, weakFr2);
+
+    RLMRealm *fr3;
+    @autoreleasepool {
+        [realm transactionWithBlock:^{ }];
+        fr3 = realm.freeze;
+    }
+    // The least recently used version is released by the cache and freed as
+    // it isn't referenced elsewhere
+    XCTAssertNil(weakFr1);
+    XCTAssertNotNil(weakFr2);
+    RLMFrozenRealmCacheStatistics *stats = realm.frozenRealmCacheStatistics;
+    XCTAssertEqual(stats.frozenVersions, 2U);
+    XCTAssertEqual(stats.evictions, 1U);
+    XCTAssertEqual(realm.freeze, fr3);
+}
+
+- (void)testEvictedFrozenRealmIsReusedWhileReferenced {
+    RLMRealm.maximumFrozenVersions = 1;
+    auto reset = realm::util::make_scope_exit([&]() noexcept { RLMRealm.maximumFrozenVersions = 0; });
+
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    RLMRealm *fr1 = realm.freeze;
+    // Lowering the limit releases the cache's reference immediately
+    RLMRealm.maximumFrozenVersions = 0;
+    XCTAssertEqual(realm.frozenRealmCacheStatistics.evictions, 1U);
+
+    // The version is still referenced, so freezing again doesn't create a
+    // second frozen Realm for it
+    XCTAssertEqual(realm.freeze, fr1);
+    RLMFrozenRealmCacheStatistics *stats = realm.frozenRealmCacheStatistics;
+    XCTAssertEqual(stats.frozenVersions, 1U);
+    XCTAssertEqual(stats.hits, 1U);
+    XCTAssertEqual(stats.misses, 1U);
+}
+
+- (void)testPinnedFrozenRealmIsNotEvicted {
+    RLMRealm.maximumFrozenVersions = 1;
+    auto reset = realm::util::make_scope_exit([&]() noexcept { RLMRealm.maximumFrozenVersions = 0; });
+
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    RLMFrozenRealmPin *pin = [realm pinFrozenSnapshot];
+    XCTAssertTrue(pin.realm.frozen);
+    XCTAssertEqual(realm.frozenRealmCacheStatistics.pinnedVersions, 1U);
+
+    [realm transactionWithBlock:^{ }];
+    RLMRealm *fr2 = realm.freeze;
+    [realm transactionWithBlock:^{ }];
+    RLMRealm *fr3 = realm.freeze;
+
+    // The pinned version is exempt, so only the unpinned ones compete for the
+    // limit. fr2 is evicted but is still alive as it's referenced here.
+    RLMFrozenRealmCacheStatistics *stats = realm.frozenRealmCacheStatistics;
+    XCTAssertEqual(stats.frozenVersions, 3U);
+    XCTAssertEqual(stats.evictions, 1U);
+    XCTAssertEqual(realm.freeze, fr3);
+    XCTAssertNoThrow([IntObject allObjectsInRealm:pin.realm]);
+    XCTAssertNoThrow([IntObject allObjectsInRealm:fr2]);
+
+    [pin unpin];
+    XCTAssertEqual(realm.frozenRealmCacheStatistics.pinnedVersions, 0U);
+}
+
+- (void)testPinnedFrozenRealmIsReusedAcrossFreezes {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    RLMFrozenRealmPin *pin = [realm pinFrozenSnapshot];
+    XCTAssertEqual(realm.freeze, pin.realm);
+    XCTAssertEqual(realm.frozenRealmCacheStatistics.hits, 1U);
+
+    // Pinning a frozen Realm pins that Realm's version
+    RLMFrozenRealmPin *pin2 = [pin.realm pinFrozenSnapshot];
+    XCTAssertEqual(pin2.realm, pin.realm);
+    XCTAssertEqual(realm.frozenRealmCacheStatistics.pinnedVersions, 1U);
+    [pin unpin];
+    XCTAssertEqual(realm.frozenRealmCacheStatistics.pinnedVersions, 1U);
+    [pin2 unpin];
+    [pin2 unpin];
+    XCTAssertEqual(realm.frozenRealmCacheStatistics.pinnedVersions, 0U);
+}
+
 - (void)testReadAfterInvalidateFrozen {
     RLMRealm *realm = [RLMRealm defaultRealm].freeze;
     [realm invalidate];
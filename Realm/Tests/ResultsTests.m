@@ -412,6 +412,123 @@
     XCTAssertEqual(3, [[results maxOfProperty:@"propA"] intValue]);
 }
 
+- (void)testLinkPropertyAggregate {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    RLMResults *owners = [OwnerObject allObjectsInRealm:realm];
+    XCTAssertEqual(0, [owners sumOfProperty:@"dog.age"].intValue);
+    XCTAssertNil([owners averageOfProperty:@"dog.age"]);
+    XCTAssertNil([owners minOfProperty:@"dog.age"]);
+    XCTAssertNil([owners maxOfProperty:@"dog.age"]);
+
+    [realm transactionWithBlock:^{
+        [OwnerObject createInRealm:realm withValue:@[@"a", @[@"a", @2]]];
+        [OwnerObject createInRealm:realm withValue:@[@"b", @[@"b", @4]]];
+        [OwnerObject createInRealm:realm withValue:@[@"c", @[@"c", @9]]];
+        [OwnerObject createInRealm:realm withValue:@[@"d", NSNull.null]];
+    }];
+
+    XCTAssertEqualObjects([owners sumOfProperty:@"dog.age"], @15);
+    XCTAssertEqualObjects([owners averageOfProperty:@"dog.age"], @5);
+    XCTAssertEqualObjects([owners minOfProperty:@"dog.age"], @2);
+    XCTAssertEqualObjects([owners maxOfProperty:@"dog.age"], @9);
+    XCTAssertEqualObjects([owners valueForKeyPath:@"@sum.dog.age"], @15);
+    XCTAssertEqualObjects([owners valueForKeyPath:@"@avg.dog.age"], @5);
+    XCTAssertEqualObjects([[owners objectsWhere:@"name != 'c'"] valueForKeyPath:@"@max.dog.age"], @4);
+
+    RLMAssertThrowsWithReasonMatching([owners sumOfProperty:@"dog.dogName"],
+                                      @"sumOfProperty: is not supported for string property 'DogObject.dogName'");
+    RLMAssertThrowsWithReasonMatching([owners sumOfProperty:@"dog.invalid"], @"Invalid property name");
+    RLMAssertThrowsWithReasonMatching([owners sumOfProperty:@"dog.owners.age"], @"Nested key paths.*not supported");
+}
+
+- (void)testPrimitiveCollectionAggregate {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    RLMResults *results = [AllPrimitiveArrays allObjectsInRealm:realm];
+    XCTAssertEqual(0, [results sumOfProperty:@"intObj"].intValue);
+    XCTAssertNil([results averageOfProperty:@"intObj"]);
+
+    NSDate *date = [NSDate dateWithTimeIntervalSince1970:1000];
+    [realm transactionWithBlock:^{
+        [AllPrimitiveArrays createInRealm:realm withValue:@{@"intObj": @[@1, @2, @3],
+                                                            @"doubleObj": @[@1.5],
+                                                            @"dateObj": @[date]}];
+        [AllPrimitiveArrays createInRealm:realm withValue:@{@"intObj": @[@10],
+                                                            @"doubleObj": @[@2.5, @5.0],
+                                                            @"dateObj": @[[date dateByAddingTimeInterval:10]]}];
+        [AllPrimitiveArrays createInRealm:realm withValue:@{}];
+    }];
+
+    XCTAssertEqualObjects([results sumOfProperty:@"intObj"], @16);
+    XCTAssertEqualObjects([results averageOfProperty:@"intObj"], @4);
+    XCTAssertEqualObjects([results minOfProperty:@"intObj"], @1);
+    XCTAssertEqualObjects([results maxOfProperty:@"intObj"], @10);
+    XCTAssertEqualObjects([results sumOfProperty:@"doubleObj"], @9.0);
+    XCTAssertEqualObjects([results averageOfProperty:@"doubleObj"], @3.0);
+    XCTAssertEqualObjects([results valueForKeyPath:@"@max.doubleObj"], @5.0);
+    XCTAssertEqualObjects([results minOfProperty:@"dateObj"], date);
+    XCTAssertEqualObjects([results maxOfProperty:@"dateObj"], [date dateByAddingTimeInterval:10]);
+
+    RLMAssertThrowsWithReasonMatching([results sumOfProperty:@"dateObj"],
+                                      @"sumOfProperty: is not supported for date property 'AllPrimitiveArrays.dateObj'");
+    RLMAssertThrowsWithReasonMatching([results minOfProperty:@"stringObj"],
+                                      @"minOfProperty: is not supported for string property 'AllPrimitiveArrays.stringObj'");
+}
+
+- (void)testPackedPropertyValues {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    RLMResults *results = [AggregateObject allObjectsInRealm:realm];
+    XCTAssertEqual(0U, [results int64ValuesOfProperty:@"intCol"].length);
+    XCTAssertEqual(0U, [results doubleValuesOfProperty:@"doubleCol"].length);
+
+    [realm transactionWithBlock:^{
+        [AggregateObject createInRealm:realm withValue:@[@3, @1.5f, @2.25, @NO, [NSDate dateWithTimeIntervalSince1970:10]]];
+        [AggregateObject createInRealm:realm withValue:@[@1, @2.5f, @4.5, @YES, [NSDate dateWithTimeIntervalSince1970:20.5]]];
+        [AggregateObject createInRealm:realm withValue:@[@2, @3.5f, @6.75, @NO, [NSDate dateWithTimeIntervalSince1970:30]]];
+    }];
+
+    NSData *ints = [results int64ValuesOfProperty:@"intCol"];
+    XCTAssertEqual(3 * sizeof(int64_t), ints.length);
+    const int64_t *intValues = (const int64_t *)ints.bytes;
+    XCTAssertEqual(3, intValues[0]);
+    XCTAssertEqual(1, intValues[1]);
+    XCTAssertEqual(2, intValues[2]);
+
+    NSData *sortedInts = [[results sortedResultsUsingKeyPath:@"intCol" ascending:YES] int64ValuesOfProperty:@"intCol"];
+    XCTAssertEqual(0, memcmp(sortedInts.bytes, (int64_t[]){1, 2, 3}, sizeof(int64_t[3])));
+
+    NSData *filtered = [[results objectsWhere:@"boolCol = NO"] doubleValuesOfProperty:@"doubleCol"];
+    XCTAssertEqual(0, memcmp(filtered.bytes, (double[]){2.25, 6.75}, sizeof(double[2])));
+    XCTAssertEqual(0, memcmp([results doubleValuesOfProperty:@"floatCol"].bytes,
+                             (double[]){1.5, 2.5, 3.5}, sizeof(double[3])));
+    XCTAssertEqual(0, memcmp([results doubleValuesOfProperty:@"intCol"].bytes,
+                             (double[]){3, 1, 2}, sizeof(double[3])));
+    XCTAssertEqual(0, memcmp([results doubleValuesOfProperty:@"dateCol"].bytes,
+                             (double[]){10, 20.5, 30}, sizeof(double[3])));
+
+    RLMAssertThrowsWithReasonMatching([results int64ValuesOfProperty:@"doubleCol"],
+                                      @"int64ValuesOfProperty: is not supported for double property 'AggregateObject.doubleCol'");
+    RLMAssertThrowsWithReasonMatching([results doubleValuesOfProperty:@"boolCol"],
+                                      @"doubleValuesOfProperty: is not supported for bool property 'AggregateObject.boolCol'");
+    RLMAssertThrowsWithReasonMatching([results doubleValuesOfProperty:@"invalid"], @"Invalid property name");
+}
+
+- (void)testPackedOptionalPropertyValues {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    [realm transactionWithBlock:^{
+        [AllOptionalTypes createInRealm:realm withValue:@{@"intObj": @5}];
+        [AllOptionalTypes createInRealm:realm withValue:@{}];
+    }];
+
+    RLMResults *results = [AllOptionalTypes allObjectsInRealm:realm];
+    NSData *data = [results doubleValuesOfProperty:@"intObj"];
+    const double *values = (const double *)data.bytes;
+    XCTAssertEqual(5.0, values[0]);
+    XCTAssertTrue(isnan(values[1]));
+
+    RLMAssertThrowsWithReasonMatching([results int64ValuesOfProperty:@"intObj"],
+                                      @"int64ValuesOfProperty: is not supported for int\\? property 'AllOptionalTypes.intObj'");
+}
+
 -(void)testRenamedPropertyObservation {
     RLMRealm *realm = self.realmWithTestPath;
     [realm transactionWithBlock:^{
@@ -874,6 +874,52 @@ RLM_COLLECTION_TYPE(NotARealClass)
 
 }
 
+- (void)testManifestRoundTrip {
+    NSURL *url = [RLMTestRealmURL() URLByAppendingPathExtension:@"manifest"];
+    RLMSchema *schema = [RLMSchema sharedSchema];
+    XCTAssertTrue([RLMSchema writeManifestForSchema:schema toURL:url]);
+
+    NSArray<RLMObjectSchema *> *objectSchema = [RLMSchema objectSchemaFromManifestAtURL:url];
+    XCTAssertEqual(objectSchema.count, schema.objectSchema.count);
+    for (RLMObjectSchema *read in objectSchema) {
+        RLMObjectSchema *expected = schema[read.className];
+        XCTAssertEqual(read.objectClass, expected.objectClass);
+        XCTAssertTrue([read isEqualToObjectSchema:expected], @"%@", read.className);
+        XCTAssertEqualObjects(read.primaryKeyProperty.name, expected.primaryKeyProperty.name);
+        XCTAssertEqual(read.isEmbedded, expected.isEmbedded);
+        XCTAssertEqual(read.isSwiftClass, expected.isSwiftClass);
+        for (RLMProperty *prop in read.properties) {
+            RLMProperty *expectedProp = expected[prop.name];
+            XCTAssertEqualObjects(prop.columnName, expectedProp.columnName);
+            XCTAssertEqual(prop.getterSel, expectedProp.getterSel);
+            XCTAssertEqual(prop.setterSel, expectedProp.setterSel);
+            XCTAssertEqual(prop.array, expectedProp.array);
+            XCTAssertEqual(prop.set, expectedProp.set);
+            XCTAssertEqual(prop.dictionary, expectedProp.dictionary);
+        }
+    }
+}
+
+- (void)testManifestFromDifferentBuildIsIgnored {
+    NSURL *url = [RLMTestRealmURL() URLByAppendingPathExtension:@"manifest"];
+    XCTAssertNil([RLMSchema objectSchemaFromManifestAtURL:url]);
+
+    [[@"not a manifest" dataUsingEncoding:NSUTF8StringEncoding] writeToURL:url atomically:YES];
+    XCTAssertNil([RLMSchema objectSchemaFromManifestAtURL:url]);
+
+    XCTAssertTrue([RLMSchema writeManifestForSchema:[RLMSchema sharedSchema] toURL:url]);
+    NSMutableDictionary *manifest = [NSPropertyListSerialization propertyListWithData:[NSData dataWithContentsOfURL:url]
+                                                                              options:NSPropertyListMutableContainers
+                                                                               format:nil error:nil];
+    NSMutableDictionary *images = manifest[@"images"];
+    for (NSString *path in images.allKeys) {
+        images[path] = NSUUID.UUID.UUIDString;
+    }
+    [[NSPropertyListSerialization dataWithPropertyList:manifest format:NSPropertyListBinaryFormat_v1_0
+                                               options:0 error:nil] writeToURL:url atomically:YES];
+    XCTAssertNil([RLMSchema objectSchemaFromManifestAtURL:url]);
+}
+
 // Can't spawn child processes on iOS
 #if !TARGET_OS_IPHONE && !TARGET_IPHONE_SIMULATOR && !TARGET_OS_MACCATALYST
 - (void)testPartialSharedSchemaInit {
@@ -1250,6 +1296,68 @@ RLM_COLLECTION_TYPE(NotARealClass)
     XCTAssertNotNil([realm.schema schemaForClassName:@"OrphanObject"]);
 }
 
+- (void)testSharedSchemaReadFromManifest {
+    NSURL *url = [RLMTestRealmURL() URLByAppendingPathExtension:@"manifest"];
+    if (self.isParent) {
+        // The first child discovers the schema and writes the manifest, and
+        // the second reads it
+        [NSFileManager.defaultManager removeItemAtURL:url error:nil];
+        RLMRunChildAndWait();
+        XCTAssertTrue([NSFileManager.defaultManager fileExistsAtPath:url.path]);
+        RLMRunChildAndWait();
+        return;
+    }
+
+    bool manifestExisted = [NSFileManager.defaultManager fileExistsAtPath:url.path];
+    RLMSchema.manifestURL = url;
+    RLMSchema *schema = [RLMSchema sharedSchema];
+    XCTAssertEqual(RLMSchema.sharedSchemaWasReadFromManifest, manifestExisted);
+    XCTAssertNotNil(schema[@"IntObject"]);
+    XCTAssertNil([schema schemaForClassName:@"NonDefaultObject"]);
+    XCTAssertEqualObjects([IntObject className], @"IntObject");
+
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    [realm transactionWithBlock:^{
+        [IntObject createInRealm:realm withValue:@[@5]];
+        [PrimaryStringObject createOrUpdateInRealm:realm withValue:@[@"a", @1]];
+    }];
+    XCTAssertEqual([IntObject allObjectsInRealm:realm].count, manifestExisted ? 2U : 1U);
+    XCTAssertEqual([PrimaryStringObject allObjectsInRealm:realm].count, 1U);
+}
+
+- (void)testLazyAccessorClassCreation {
+    if (self.isParent) {
+        RLMRunChildAndWait();
+        return;
+    }
+
+    RLMSchema.createsAccessorClassesLazily = YES;
+    RLMSchema *schema = [RLMSchema sharedSchema];
+    XCTAssertGreaterThan(schema.objectSchema.count, 2U);
+    XCTAssertEqual(RLMSchema.materializedAccessorClassCount, 0U);
+
+    // Creating an unmanaged object creates the accessors for just that class
+    IntObject *unmanaged = [[IntObject alloc] initWithValue:@[@1]];
+    XCTAssertEqual(RLMSchema.materializedAccessorClassCount, 1U);
+    XCTAssertEqual(unmanaged.class, schema[@"IntObject"].unmanagedClass);
+    XCTAssertEqual(unmanaged.intCol, 1);
+
+    // Opening a Realm doesn't create any
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    XCTAssertEqual(RLMSchema.materializedAccessorClassCount, 1U);
+
+    [realm beginWriteTransaction];
+    [realm addObject:unmanaged];
+    StringObject *so = [StringObject createInRealm:realm withValue:@[@"a"]];
+    [realm commitWriteTransaction];
+    XCTAssertEqual(RLMSchema.materializedAccessorClassCount, 2U);
+    XCTAssertEqual(unmanaged.class, schema[@"IntObject"].accessorClass);
+    XCTAssertEqualObjects(so.stringCol, @"a");
+    XCTAssertEqual([[IntObject allObjectsInRealm:realm].firstObject intCol], 1);
+    XCTAssertEqual(RLMSchema.materializedAccessorClassCount, 2U);
+    XCTAssertGreaterThan(RLMSchema.accessorClassCreationTime, 0);
+}
+
 - (void)testDynamicUnmanagedAccessorsBeforeSharedSchemaInit {
     if (self.isParent) {
         RLMRunChildAndWait();
@@ -101,6 +101,140 @@
     XCTAssertEqual(sr.count, 4);
 }
 
+- (void)testSectionKeyFirstCharacter {
+    RLMRealm *realm = self.realmWithTestPath;
+    [realm transactionWithBlock:^{
+        for (NSString *str in @[@"apple", @"banana", @"", @"apricot", @"\u00e9clair", @"blueberry"]) {
+            [StringObject createInRealm:realm withValue:@[str]];
+        }
+    }];
+
+    RLMResults<StringObject *> *results = [StringObject allObjectsInRealm:realm];
+    RLMSectionedResults *sr = [results sectionedResultsSortedUsingKeyPath:@"stringCol"
+                                                                 ascending:YES
+                                                                  keyBlock:[RLMSectionKey firstCharacterOfProperty:@"stringCol"]];
+    XCTAssertEqual(sr.count, 4);
+    XCTAssertEqualObjects([NSSet setWithArray:sr.allKeys],
+                          ([NSSet setWithArray:@[@"", @"a", @"b", @"\u00e9"]]));
+    NSArray *keys = sr.allKeys;
+    XCTAssertEqual(sr[[keys indexOfObject:@"a"]].count, 2);
+    XCTAssertEqual(sr[[keys indexOfObject:@"b"]].count, 2);
+    XCTAssertEqual(sr[[keys indexOfObject:@""]].count, 1);
+    XCTAssertEqual(sr[[keys indexOfObject:@"\u00e9"]].count, 1);
+
+    [realm transactionWithBlock:^{
+        [StringObject createInRealm:realm withValue:@[@"cherry"]];
+    }];
+    XCTAssertEqual(sr.count, 5);
+
+    // The block computes the same keys when called directly
+    RLMSectionedResultsKeyBlock block = [RLMSectionKey firstCharacterOfProperty:@"stringCol"];
+    XCTAssertEqualObjects(block([[StringObject alloc] initWithValue:@[@"\u00e9clair"]]), @"\u00e9");
+
+    RLMSectionedResults *frozen = [sr freeze];
+    XCTAssertEqual(frozen.count, 5);
+    XCTAssertEqual([frozen thaw].count, 5);
+}
+
+- (void)testSectionKeyValue {
+    [self createObjects];
+    RLMRealm *realm = self.realmWithTestPath;
+
+    RLMResults<AllTypesObject *> *results = [AllTypesObject allObjectsInRealm:realm];
+    RLMSectionedResults *sr = [results sectionedResultsSortedUsingKeyPath:@"intCol"
+                                                                 ascending:YES
+                                                                  keyBlock:[RLMSectionKey valueOfProperty:@"intCol"]];
+    XCTAssertEqualObjects(sr.allKeys, (@[@0, @1]));
+    XCTAssertEqual(sr[0].count, 3);
+    XCTAssertEqual(sr[1].count, 6);
+
+    [self createPrimitiveObject];
+    AllPrimitiveArrays *obj = [AllPrimitiveArrays allObjectsInRealm:realm][0];
+    sr = [obj.stringObj sectionedResultsSortedUsingKeyPath:@"self"
+                                                 ascending:YES
+                                                  keyBlock:[RLMSectionKey firstCharacterOfProperty:@"self"]];
+    XCTAssertEqualObjects(sr.allKeys, (@[@"b", @"f"]));
+}
+
+- (void)testSectionKeyIntegerBucket {
+    RLMRealm *realm = self.realmWithTestPath;
+    [realm transactionWithBlock:^{
+        for (NSNumber *value in @[@-11, @-1, @0, @9, @10, @25]) {
+            [IntObject createInRealm:realm withValue:@[value]];
+        }
+    }];
+
+    RLMResults<IntObject *> *results = [IntObject allObjectsInRealm:realm];
+    RLMSectionedResults *sr = [results sectionedResultsSortedUsingKeyPath:@"intCol"
+                                                                 ascending:YES
+                                                                  keyBlock:[RLMSectionKey integerBucketOfProperty:@"intCol"
+                                                                                                       bucketSize:10]];
+    XCTAssertEqualObjects(sr.allKeys, (@[@-20, @-10, @0, @10, @20]));
+    XCTAssertEqual(sr[1].count, 1);
+    XCTAssertEqual(sr[2].count, 2);
+
+    RLMAssertThrowsWithReason([RLMSectionKey integerBucketOfProperty:@"intCol" bucketSize:0],
+                              @"Invalid bucket size 0: must be greater than zero.");
+}
+
+- (void)testSectionKeyDateBucket {
+    RLMRealm *realm = self.realmWithTestPath;
+    [realm transactionWithBlock:^{
+        for (NSNumber *seconds in @[@-43200, @1673776800, @1675209540, @1675209600]) {
+            [DateObject createInRealm:realm withValue:@[[NSDate dateWithTimeIntervalSince1970:seconds.doubleValue]]];
+        }
+    }];
+
+    RLMResults<DateObject *> *results = [DateObject allObjectsInRealm:realm];
+    NSTimeZone *utc = [NSTimeZone timeZoneForSecondsFromGMT:0];
+    RLMSectionedResults *sr = [results sectionedResultsSortedUsingKeyPath:@"dateCol"
+                                                                 ascending:YES
+                                                                  keyBlock:[RLMSectionKey dateBucketOfProperty:@"dateCol"
+                                                                                                  calendarUnit:NSCalendarUnitMonth
+                                                                                                      timeZone:utc]];
+    XCTAssertEqualObjects(sr.allKeys, (@[[NSDate dateWithTimeIntervalSince1970:-2678400],
+                                         [NSDate dateWithTimeIntervalSince1970:1672531200],
+                                         [NSDate dateWithTimeIntervalSince1970:1675209600]]));
+    XCTAssertEqual(sr[1].count, 2);
+
+    sr = [results sectionedResultsSortedUsingKeyPath:@"dateCol"
+                                           ascending:YES
+                                            keyBlock:[RLMSectionKey dateBucketOfProperty:@"dateCol"
+                                                                            calendarUnit:NSCalendarUnitYear
+                                                                                timeZone:utc]];
+    XCTAssertEqualObjects(sr.allKeys, (@[[NSDate dateWithTimeIntervalSince1970:-31536000],
+                                         [NSDate dateWithTimeIntervalSince1970:1672531200]]));
+
+    // Noon UTC on the day DST began is 08:00 EDT, but that day began at midnight EST
+    RLMSectionedResultsKeyBlock block = [RLMSectionKey dateBucketOfProperty:@"dateCol"
+                                                               calendarUnit:NSCalendarUnitDay
+                                                                   timeZone:[NSTimeZone timeZoneWithName:@"America/New_York"]];
+    DateObject *obj = [[DateObject alloc] initWithValue:@[[NSDate dateWithTimeIntervalSince1970:1678622400]]];
+    XCTAssertEqualObjects(block(obj), [NSDate dateWithTimeIntervalSince1970:1678597200]);
+
+    RLMAssertThrowsWithReason([RLMSectionKey dateBucketOfProperty:@"dateCol" calendarUnit:NSCalendarUnitWeekOfYear timeZone:nil],
+                              @"Invalid calendar unit");
+}
+
+- (void)testSectionKeyInvalidProperty {
+    [self createObjects];
+    RLMRealm *realm = self.realmWithTestPath;
+    RLMResults<AllTypesObject *> *results = [AllTypesObject allObjectsInRealm:realm];
+
+    RLMAssertThrowsWithReason([results sectionedResultsSortedUsingKeyPath:@"intCol"
+                                                                ascending:YES
+                                                                 keyBlock:[RLMSectionKey firstCharacterOfProperty:@"intCol"]],
+                              @"Property 'AllTypesObject.intCol' of type 'int' cannot be used as a first character section key.");
+    RLMAssertThrowsWithReason([results sectionedResultsSortedUsingKeyPath:@"intCol"
+                                                                ascending:YES
+                                                                 keyBlock:[RLMSectionKey valueOfProperty:@"objectCol"]],
+                              @"cannot be used as a value section key");
+    RLMAssertThrowsWithReason([results sectionedResultsSortedUsingKeyPath:@"intCol"
+                                                                ascending:YES
+                                                                 keyBlock:[RLMSectionKey valueOfProperty:@"missing"]],
+                              @"missing");
+}
+
 - (NSDictionary *)keyPathsAndValues {
     return @{
         @"intCol": @{
@@ -241,4 +241,10 @@ internal class ObjectUtil {
         _ = ObjectUtil.runOnce
         return getProperties(cls)
     }
+
+    // Schemas read from a manifest skip getSwiftProperties(), so the bridge
+    // callback has to be installed separately
+    internal class func installSwiftBridgeCallback() {
+        _ = ObjectUtil.runOnce
+    }
 }
@@ -243,18 +243,113 @@ extension List {
     /**
      Replace the given `subRange` of elements with `newElements`.
 
+     All of the new elements are validated before the List is modified, and
+     observers receive a single change notification.
+
      - parameter subrange:    The range of elements to be replaced.
      - parameter newElements: The new elements to be inserted into the List.
      */
     public func replaceSubrange<C: Collection, R>(_ subrange: R, with newElements: C)
         where C.Iterator.Element == Element, R: RangeExpression, List<Element>.Index == R.Bound {
             let subrange = subrange.relative(to: self)
-            for _ in subrange.lowerBound..<subrange.upperBound {
-                remove(at: subrange.lowerBound)
-            }
-            for x in newElements.reversed() {
-                insert(x, at: subrange.lowerBound)
-            }
+            throwForNegativeIndex(subrange.lowerBound)
+            rlmArray.replaceObjects(in: NSRange(location: subrange.lowerBound, length: subrange.count),
+                                    with: newElements.map { staticBridgeCast(fromSwift: $0) as AnyObject })
+    }
+
+    /**
+     Reorders the List so that the element at index `i` is the element which was previously at index `indexes[i]`.
+
+     This performs the minimum number of exchanges needed to reorder the List and sends a single change notification,
+     which is much faster than moving elements one at a time.
+
+     - warning: This method may only be called during a write transaction.
+
+     - warning: This method will throw an exception if `indexes` is not a permutation of the List's indices.
+
+     - parameter indexes: The previous index of each element in the new order.
+     */
+    public func reorder(_ indexes: [Int]) {
+        for index in indexes {
+            throwForNegativeIndex(index)
+        }
+        rlmArray.reorderObjects(withIndexes: indexes.map { NSNumber(value: $0) })
+    }
+}
+
+extension List where Element: ObjectBase {
+    /**
+     Removes all objects in the List which match the given query.
+
+     The query is evaluated once and the matching objects are removed in a single pass, with a single change
+     notification. The objects are not deleted from the Realm.
+
+     - warning: This method may only be called during a write transaction.
+
+     - parameter isIncluded: The query closure with which to select the objects to remove.
+     */
+    public func remove(where isIncluded: ((Query<Element>) -> Query<Bool>)) {
+        remove(matching: isIncluded(Query()).predicate)
+    }
+
+    /**
+     Removes all objects in the List which match the given predicate.
+
+     - warning: This method may only be called during a write transaction.
+
+     - parameter predicate: The predicate with which to select the objects to remove.
+     */
+    public func remove(matching predicate: NSPredicate) {
+        rlmArray.removeObjects(with: predicate)
+    }
+}
+
+// MARK: - Reading Property Values
+
+extension List where Element: ObjectBase {
+    /**
+     Returns the values of the given integer property for each object in the list, in the same order as the objects.
+
+     The values are read directly from the Realm into the returned array without creating an object or bridging each
+     value, which is much faster than `value(forKey:)` for reading a single property of many objects.
+
+     - parameter keyPath: The key path of a non-optional `Int` property.
+     */
+    public func values(of keyPath: KeyPath<Element, Int>) -> [Int] {
+        intValues(ofProperty: _name(for: keyPath))
+    }
+
+    /**
+     Returns the values of the given floating-point property for each object in the list, in the same order as the
+     objects.
+
+     The values are read directly from the Realm into the returned array without creating an object or bridging each
+     value.
+
+     - parameter keyPath: The key path of a `Double` property.
+     */
+    public func values(of keyPath: KeyPath<Element, Double>) -> [Double] {
+        doubleValues(ofProperty: _name(for: keyPath))
+    }
+
+    /**
+     Returns the values of the given integer property for each object in the list, in the same order as the objects.
+
+     - parameter property: The name of a non-optional `Int` property.
+     */
+    public func intValues(ofProperty property: String) -> [Int] {
+        unpackInt64Values(rlmArray.int64Values(ofProperty: property))
+    }
+
+    /**
+     Returns the values of the given property for each object in the list as `Double`s, in the same order as the
+     objects. `Int` and `Float` values are converted to `Double`, dates are returned as seconds since 1970, and `nil`
+     values are returned as NaN.
+
+     - parameter property: The name of an `Int`, `Float`, `Double` or `Date` property.
+     */
+    public func doubleValues(ofProperty property: String) -> [Double] {
+        unpackDoubleValues(rlmArray.doubleValues(ofProperty: property))
     }
 }
 
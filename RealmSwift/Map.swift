@@ -301,6 +301,27 @@ public final class Map<Key: _MapKey, Value: RealmCollectionValue>: RLMSwiftColle
         return found
     }
 
+    /**
+     Calls the given closure with each key-value pair in the Map.
+
+     This reads each entry only once and is faster than iterating over the Map
+     and looking up each key. Set `stop` to `true` in the closure to end the
+     enumeration early.
+
+     - parameter body: A closure which is called with each key-value pair.
+     */
+    public func enumerateKeysAndValues(_ body: (_ key: Key, _ value: Value, _ stop: inout Bool) -> Void) {
+        withoutActuallyEscaping(body) { body in
+            rlmDictionary.enumerateKeysAndObjects { (k, v, shouldStop) in
+                var stop = false
+                body(staticBridgeCast(fromObjectiveC: k), staticBridgeCast(fromObjectiveC: v), &stop)
+                if stop {
+                    shouldStop.pointee = true
+                }
+            }
+        }
+    }
+
     // MARK: Sorting
 
     /**
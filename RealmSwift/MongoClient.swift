@@ -225,6 +225,10 @@ extension FindOneAndModifyOptions {
 /// The result of an `updateOne` or `updateMany` operation a `MongoCollection`.
 public typealias UpdateResult = RLMUpdateResult
 
+/// Options controlling how `MongoCollection.insertMany(_:options:progress:_:)` splits the documents
+/// into multiple requests.
+public typealias InsertManyOptions = RLMInsertManyOptions
+
 /// Block which returns Result.success(DocumentId) on a successful insert or Result.failure(error)
 public typealias MongoInsertBlock = @Sendable (Result<AnyBSON, Error>) -> Void
 /// Block which returns Result.success([ObjectId]) on a successful insertMany or Result.failure(error)
@@ -274,6 +278,26 @@ public protocol ChangeEventDelegate: AnyObject {
     func changeStreamDidReceive(changeEvent: AnyBSON?)
 }
 
+/// Options controlling how a batched change stream groups change events.
+public typealias ChangeStreamBatchOptions = RLMChangeStreamBatchOptions
+
+/// Delegate which is used for subscribing to changes on a batched `MongoCollection.watch()` stream,
+/// which delivers change events in groups rather than individually.
+public protocol ChangeEventBatchDelegate: AnyObject {
+    /// The stream was opened.
+    /// - Parameter changeStream: The `ChangeStream` subscribing to the stream changes.
+    func changeStreamDidOpen(_ changeStream: ChangeStream)
+    /// The stream has been closed.
+    /// - Parameter error: If an error occurred when closing the stream, an error will be passed.
+    func changeStreamDidClose(with error: Error?)
+    /// A error has occurred while streaming.
+    /// - Parameter error: The streaming error.
+    func changeStreamDidReceive(error: Error)
+    /// Invoked when one or more change events have been received.
+    /// - Parameter changeEvents: The change events in BSON format, in the order they were received.
+    func changeStreamDidReceive(changeEvents: [AnyBSON])
+}
+
 extension MongoCollection {
     /// Opens a MongoDB change stream against the collection to watch for changes. The resulting stream will be notified
     /// of all events on this collection that the active user is authorized to see based on the configured MongoDB
@@ -319,6 +343,26 @@ extension MongoCollection {
                 delegate: ChangeEventDelegateProxy(delegate),
                 delegateQueue: queue)
     }
+
+    /// Opens a MongoDB change stream against the collection to watch for changes, delivering the change events to
+    /// the delegate in batches. Compared to the unbatched methods, this avoids a dispatch to the queue and a delegate
+    /// call for every change event when many changes arrive at once.
+    /// - Parameters:
+    ///   - matchFilter: An optional $match filter to apply to incoming change events
+    ///   - filterIds: An optional list of the _ids of the documents to watch.
+    ///   - batchOptions: Options controlling how change events are grouped.
+    ///   - delegate: The delegate that will react to events and errors from the resulting change stream.
+    ///   - queue: Dispatches streaming events to an optional queue, if no queue is provided the main queue is used
+    /// - Returns: A ChangeStream which will manage the streaming events.
+    public func watch(matchFilter: Document? = nil, filterIds: [ObjectId]? = nil,
+                      batchOptions: ChangeStreamBatchOptions, delegate: ChangeEventBatchDelegate,
+                      queue: DispatchQueue = .main) -> ChangeStream {
+        __watch(withMatchFilter: matchFilter.map { ObjectiveCSupport.convert($0) },
+                filterIds: filterIds,
+                batchOptions: batchOptions,
+                delegate: ChangeEventBatchDelegateProxy(delegate),
+                delegateQueue: queue)
+    }
 }
 
 // MongoCollection methods with result type completions
@@ -357,6 +401,30 @@ extension MongoCollection {
         }
     }
 
+    /// Encodes the provided values to BSON and inserts them, splitting them into multiple requests which are
+    /// sent concurrently. If any values are missing identifiers, they will be generated.
+    ///
+    /// If a request fails no further requests are sent and the completion is called with the error, but the
+    /// documents in requests which had already been sent may have been inserted.
+    /// - Parameters:
+    ///   - documents: The `Document` values in a bson array to insert.
+    ///   - options: Options controlling how the documents are split into requests.
+    ///   - progress: An optional block which is called with the number of documents inserted so far and the
+    ///               total number of documents each time a request completes.
+    ///   - completion: The result of the insert, returns an array inserted document ids in order.
+    public func insertMany(_ documents: [Document], options: InsertManyOptions,
+                           progress: (@Sendable (Int, Int) -> Void)? = nil,
+                           _ completion: @escaping MongoInsertManyBlock) {
+        let bson = documents.map(ObjectiveCSupport.convert)
+        __insertManyDocuments(bson, options: options, progress: insertProgressBlock(progress)) { objectIds, error in
+            if let objectIds = objectIds?.compactMap(ObjectiveCSupport.convert) {
+                completion(.success(objectIds))
+            } else {
+                completion(.failure(error ?? Realm.Error.callFailed))
+            }
+        }
+    }
+
     /// Finds the documents in this collection which match the provided filter.
     /// - Parameters:
     ///   - filter: A `Document` as bson that should match the query.
@@ -603,6 +671,21 @@ extension MongoCollection {
             .compactMap(ObjectiveCSupport.convertBson(object:))
     }
 
+    /// Encodes the provided values to BSON and inserts them, splitting them into multiple requests which are
+    /// sent concurrently. If any values are missing identifiers, they will be generated.
+    /// - Parameters:
+    ///   - documents: The `Document` values in a bson array to insert.
+    ///   - options: Options controlling how the documents are split into requests.
+    ///   - progress: An optional block which is called with the number of documents inserted so far and the
+    ///               total number of documents each time a request completes.
+    /// - Returns: The object ids of inserted documents.
+    public func insertMany(_ documents: [Document], options: InsertManyOptions,
+                           progress: (@Sendable (Int, Int) -> Void)? = nil) async throws -> [AnyBSON] {
+        try await __insertManyDocuments(documents.map(ObjectiveCSupport.convert), options: options,
+                                        progress: insertProgressBlock(progress))
+            .compactMap(ObjectiveCSupport.convertBson(object:))
+    }
+
 #if compiler(<6)
     /// Finds the documents in this collection which match the provided filter.
     /// - Parameters:
@@ -875,6 +958,13 @@ extension MongoCollection {
 #endif
 }
 
+private func insertProgressBlock(_ progress: (@Sendable (Int, Int) -> Void)?) -> RLMMongoInsertProgressBlock? {
+    guard let progress = progress else { return nil }
+    return { insertedCount, totalCount in
+        progress(Int(insertedCount), Int(totalCount))
+    }
+}
+
 private class ChangeEventDelegateProxy: RLMChangeEventDelegate {
     // NEXT-MAJOR: This doesn't need to be weak and making it not weak would
     // allow removing the class requirement on ChangeEventDelegate
@@ -902,6 +992,30 @@ private class ChangeEventDelegateProxy: RLMChangeEventDelegate {
     }
 }
 
+private class ChangeEventBatchDelegateProxy: RLMChangeEventBatchDelegate {
+    private weak var proxyDelegate: ChangeEventBatchDelegate?
+
+    init(_ proxyDelegate: ChangeEventBatchDelegate) {
+        self.proxyDelegate = proxyDelegate
+    }
+
+    func changeStreamDidOpen(_ changeStream: RLMChangeStream) {
+        proxyDelegate?.changeStreamDidOpen(changeStream)
+    }
+
+    func changeStreamDidCloseWithError(_ error: Error?) {
+        proxyDelegate?.changeStreamDidClose(with: error)
+    }
+
+    func changeStreamDidReceiveError(_ error: Error) {
+        proxyDelegate?.changeStreamDidReceive(error: error)
+    }
+
+    func changeStreamDidReceiveChangeEvents(_ changeEvents: [RLMBSON]) {
+        proxyDelegate?.changeStreamDidReceive(changeEvents: changeEvents.compactMap { ObjectiveCSupport.convert(object: $0) })
+    }
+}
+
 @available(macOS 10.15, iOS 13.0, tvOS 13.0, watchOS 6.0, *)
 extension Publishers {
     private class WatchSubscription<S: Subscriber>: RLMChangeEventDelegate, Subscription where S.Input == AnyBSON, S.Failure == Error {
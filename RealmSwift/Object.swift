@@ -155,6 +155,18 @@ extension Object: _RealmCollectionValueInsideOptional {
      */
     @objc open class func primaryKey() -> String? { return nil }
 
+    /**
+     Override this method to make managed objects of this type without a
+     primary key use the object they refer to as their identity for
+     `isEqual(_:)` and `hash`.
+
+     - warning: When this returns `true`, an unmanaged object's hash changes
+                when it is added to a Realm, so it must not be in a `Set` or
+                used as a dictionary key at that point.
+     - returns: Whether objects of this type use a stable identity.
+     */
+    @objc open class func usesStableIdentity() -> Bool { return false }
+
     /**
      Override this method to specify the names of properties to ignore. These
      properties will not be managed by the Realm that manages the object.
@@ -659,7 +671,8 @@ extension Object: _RealmCollectionValueInsideOptional {
      - note: Equality comparison is implemented by `isEqual(_:)`. If the object type
              is defined with a primary key, `isEqual(_:)` behaves identically to this
              method. If the object type is not defined with a primary key,
-             `isEqual(_:)` uses the `NSObject` behavior of comparing object identity.
+             `isEqual(_:)` uses the `NSObject` behavior of comparing object identity
+             unless `usesStableIdentity()` is overridden to return `true`.
              This method can be used to compare two objects for database equality
              whether or not their object type defines a primary key.
 
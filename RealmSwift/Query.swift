@@ -236,6 +236,12 @@ public struct Query<T> {
         return buildPredicate(node)
     }
 
+    /// Constructs the predicate format used by `PreparedQuery`, whose only
+    /// arguments are the constant values in the query.
+    fileprivate func _constructPreparedPredicate() -> (String, [Any]) {
+        return buildPredicate(node, inlineSubscripts: true)
+    }
+
     /// Creates an NSPredicate compatible string.
     /// - Returns: A tuple containing the predicate string and an array of arguments.
 
@@ -903,6 +909,118 @@ public extension Query where T: OptionalProtocol, T.Wrapped: EmbeddedObject {
     }
 }
 
+// MARK: Prepared Queries
+
+/**
+ A query which is parsed once and can then be run many times with different argument values.
+
+ Filtering with `where` or `filter(_:)` builds and parses a predicate each time it is called. When
+ the same query is run repeatedly with different values, a `PreparedQuery` can be used to do that
+ work once and then supply only the new values each time:
+
+ ```swift
+ let byAgeAndName = PreparedQuery(Person.self) { $0.age > 0 && $0.name.starts(with: "") }
+ let results = byAgeAndName.results(in: realm, 18, "J")
+ ```
+
+ When created from a query closure, each constant value which a property is compared against is a
+ placeholder, and arguments replace them in the order they appear in the query. This includes both
+ bounds of `contains(_:)` with a range, the value in `in(_:)` and `geoWithin(_:)`, and the count
+ compared against in a subquery. Map keys and collection indexes used as subscripts are part of
+ the query rather than placeholders. Subscripts using `.any` are not supported.
+
+ When created from a predicate format string, arguments replace each `%@` in order, and format
+ specifiers other than `%@` are not supported.
+
+ Running a prepared query with a different number of arguments than it has placeholders throws
+ an exception.
+
+ Only building and parsing the predicate is done once. Each run still copies the predicate with the
+ arguments substituted in and converts it to a query on the Realm, so that part of the cost is the
+ same as for an unprepared query.
+ */
+public struct PreparedQuery<Element: Object>: Sendable {
+    private let query: RLMPreparedQuery<AnyObject>
+
+    /**
+     Creates a prepared query from a predicate format string.
+
+     - parameter type:            The type of the objects to query.
+     - parameter predicateFormat: A predicate format string using `%@` for each argument.
+     */
+    public init(_ type: Element.Type = Element.self, _ predicateFormat: String) {
+        query = RLMPreparedQuery(className: Element.className(), where: predicateFormat)
+    }
+
+    /**
+     Creates a prepared query from a query closure.
+
+     The values used in the closure only mark where arguments go, and are not used when running
+     the query.
+
+     - parameter type:       The type of the objects to query.
+     - parameter isIncluded: The query closure to prepare.
+     */
+    public init(_ type: Element.Type = Element.self, _ isIncluded: ((Query<Element>) -> Query<Bool>)) {
+        let (predicateFormat, constants) = isIncluded(Query())._constructPreparedPredicate()
+        if predicateFormat.contains("%K") {
+            throwRealmException("Prepared queries do not support `.any` subscripts.")
+        }
+        self.init(type, predicateFormat)
+        // Each constant in the closure must map to exactly one placeholder
+        // for the arguments to line up with the values they replace
+        if query.argumentCount != constants.count {
+            throwRealmException("Query '\(predicateFormat)' has \(query.argumentCount) placeholders but "
+                                + "\(constants.count) constant values, and cannot be used as a prepared query.")
+        }
+    }
+
+    /// The number of arguments which must be supplied when running the query.
+    public var argumentCount: Int {
+        Int(query.argumentCount)
+    }
+
+    /**
+     Returns all objects of the query's type in the Realm which match the query.
+
+     - parameter realm:     The Realm to run the query on.
+     - parameter arguments: The values to use for each placeholder in the query, in order.
+     */
+    public func results(in realm: Realm, _ arguments: Any...) -> Results<Element> {
+        results(in: realm, arguments: arguments)
+    }
+
+    /**
+     Returns all objects of the query's type in the Realm which match the query.
+
+     - parameter realm:     The Realm to run the query on.
+     - parameter arguments: The values to use for each placeholder in the query, in order.
+     */
+    public func results(in realm: Realm, arguments: [Any]) -> Results<Element> {
+        Results(query.results(in: realm.rlmRealm, arguments: unwrapOptionals(in: arguments)))
+    }
+
+    /**
+     Returns the objects in the results which match the query.
+
+     - parameter results:   The results to filter.
+     - parameter arguments: The values to use for each placeholder in the query, in order.
+     */
+    public func filter(_ results: Results<Element>, _ arguments: Any...) -> Results<Element> {
+        filter(results, arguments: arguments)
+    }
+
+    /**
+     Returns the objects in the results which match the query.
+
+     - parameter results:   The results to filter.
+     - parameter arguments: The values to use for each placeholder in the query, in order.
+     */
+    public func filter(_ results: Results<Element>, arguments: [Any]) -> Results<Element> {
+        results.filter(query.predicate(withArguments: unwrapOptionals(in: arguments)))
+    }
+}
+
 /// Tag protocol for all numeric types.
 public protocol _QueryNumeric: _RealmSchemaDiscoverable { }
 extension Int: _QueryNumeric { }
@@ -966,7 +1084,11 @@ private enum CollectionSubscript {
     case all
 }
 
-private func buildPredicate(_ root: QueryNode, subqueryCount: Int = 0) -> (String, [Any]) {
+// If `inlineSubscripts` is true, map keys and collection indexes are written
+// into the format string as literals rather than passed as arguments, so that
+// the only arguments are the constant values being compared against.
+private func buildPredicate(_ root: QueryNode, subqueryCount: Int = 0,
+                            inlineSubscripts: Bool = false) -> (String, [Any]) {
     let formatStr = NSMutableString()
     let arguments = NSMutableArray()
     var subqueryCounter = subqueryCount
@@ -1020,6 +1142,21 @@ private func buildPredicate(_ root: QueryNode, subqueryCount: Int = 0) -> (Strin
         }
     }
 
+    func buildSubscript(_ key: Any) {
+        guard inlineSubscripts else {
+            formatStr.append("[%@]")
+            arguments.add(key)
+            return
+        }
+        if let key = key as? String {
+            let escaped = key.replacingOccurrences(of: "\\", with: "\\\\")
+                .replacingOccurrences(of: "\"", with: "\\\"")
+            formatStr.append("[\"\(escaped)\"]")
+        } else {
+            formatStr.append("[\(key)]")
+        }
+    }
+
     func strOptions(_ options: StringOptions) -> String {
         if options == [] {
             return ""
@@ -1069,18 +1206,15 @@ private func buildPredicate(_ root: QueryNode, subqueryCount: Int = 0) -> (Strin
             formatStr.append(").@count")
         case .mapSubscript(let keyPath, let key):
             build(keyPath)
-            formatStr.append("[%@]")
-            arguments.add(key)
+            buildSubscript(key)
         case .mapAnySubscripts(let keyPath, let keys):
             build(keyPath)
             for key in keys {
                 switch key {
                 case .index(let index):
-                    formatStr.append("[%@]")
-                    arguments.add(index)
+                    buildSubscript(index)
                 case .key(let key):
-                    formatStr.append("[%@]")
-                    arguments.add(key)
+                    buildSubscript(key)
                 case .all:
                     formatStr.append("[%K]")
                     arguments.add("#any")
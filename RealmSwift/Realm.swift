@@ -21,6 +21,32 @@ import Realm.Private
 /// The Id of the asynchronous transaction.
 public typealias AsyncTransactionId = RLMAsyncTransactionId
 
+/// Statistics about the frozen versions of a Realm file cached by `Realm.freeze()`.
+public typealias FrozenRealmCacheStatistics = RLMFrozenRealmCacheStatistics
+
+/**
+ A frozen Realm which is kept cached until the pin is released.
+
+ - see: `Realm.pinFrozenSnapshot()`
+ */
+public struct FrozenRealmPin: Sendable {
+    private let rlmPin: RLMFrozenRealmPin
+
+    internal init(_ rlmPin: RLMFrozenRealmPin) {
+        self.rlmPin = rlmPin
+    }
+
+    /// The pinned frozen Realm.
+    public var realm: Realm {
+        return Realm(rlmPin.realm)
+    }
+
+    /// Releases the pin. Does nothing if the pin was already released.
+    public func unpin() {
+        rlmPin.unpin()
+    }
+}
+
 /**
  A `Realm` instance (also referred to as "a Realm") represents a Realm database.
 
@@ -574,9 +600,7 @@ public typealias AsyncTransactionId = RLMAsyncTransactionId
      Realm. Must be `.error` for object types without a primary key.
      */
     public func add<S: Sequence>(_ objects: S, update: UpdatePolicy = .error) where S.Iterator.Element: Object {
-        for obj in objects {
-            add(obj, update: update)
-        }
+        RLMAddObjectsToRealm(Array(objects) as NSArray, rlmRealm, RLMUpdatePolicy(rawValue: UInt(update.rawValue))!)
     }
 
     /**
@@ -619,6 +643,67 @@ public typealias AsyncTransactionId = RLMAsyncTransactionId
                                                               RLMUpdatePolicy(rawValue: UInt(update.rawValue))!), to: type)
     }
 
+    /**
+     Creates a Realm object for each value in a sequence, adding them to the Realm and returning them.
+
+     This is equivalent to calling `create(_:value:update:)` for each value, but looks up the
+     type and sets up the state needed to create objects only once rather than once per object,
+     which makes it considerably faster when creating large numbers of objects.
+
+     Each value is interpreted in the same way as the `value` argument to `create(_:value:update:)`.
+
+     - warning: This method may only be called during a write transaction.
+
+     - parameter type:   The type of the objects to create.
+     - parameter values: A sequence of values used to populate the objects.
+     - parameter update: What to do if an object with the same primary key already exists. Must be `.error` for object
+     types without a primary key.
+
+     - returns: The newly created objects, in the same order as `values`.
+     */
+    @discardableResult
+    public func create<T: Object, S: Sequence>(_ type: T.Type, values: S, update: UpdatePolicy = .error) -> [T] {
+        if update != .error {
+            RLMVerifyHasPrimaryKey(type)
+        }
+        let typeName = (type as Object.Type).className()
+        let objects = RLMCreateObjectsInRealmWithValues(rlmRealm, typeName, Array(values) as NSArray,
+                                                        RLMUpdatePolicy(rawValue: UInt(update.rawValue))!,
+                                                        true, 0, nil)
+        return (objects ?? []).map { unsafeDowncast($0, to: type) }
+    }
+
+    /**
+     Creates a Realm object for each value in a sequence without returning the created objects.
+
+     This behaves like `create(_:values:update:)`, but skips creating accessor objects for the
+     newly created objects, and reports progress periodically for long-running imports.
+
+     - warning: This method may only be called during a write transaction.
+
+     - parameter type:      The type of the objects to create.
+     - parameter values:    A sequence of values used to populate the objects.
+     - parameter update:    What to do if an object with the same primary key already exists. Must be `.error` for
+                            object types without a primary key.
+     - parameter batchSize: The number of objects to create between each call to `progress`. If zero,
+                            `progress` is only called once all objects have been created. Must not be negative.
+     - parameter progress:  A block which is called with the total number of objects created so far after
+                            every `batchSize` objects and once after all of the objects have been created.
+     */
+    public func create<T: Object, S: Sequence>(_ type: T.Type, values: S, update: UpdatePolicy = .error,
+                                               batchSize: Int, progress: ((Int) -> Void)? = nil) {
+        if batchSize < 0 {
+            throwRealmException("batchSize must be 0 or greater, not \(batchSize)")
+        }
+        if update != .error {
+            RLMVerifyHasPrimaryKey(type)
+        }
+        let typeName = (type as Object.Type).className()
+        RLMCreateObjectsInRealmWithValues(rlmRealm, typeName, Array(values) as NSArray,
+                                          RLMUpdatePolicy(rawValue: UInt(update.rawValue))!,
+                                          false, UInt(batchSize), progress.map { progress in { progress(Int($0)) } })
+    }
+
     /**
      This method is useful only in specialized circumstances, for example, when building
      components that integrate with Realm. If you are simply building an app on Realm, it is
@@ -945,6 +1030,48 @@ public typealias AsyncTransactionId = RLMAsyncTransactionId
         return isFrozen ? Realm(rlmRealm.thaw()) : self
     }
 
+    /**
+     The number of recently frozen versions of each Realm file which `freeze()` keeps alive.
+
+     The cache holds a strong reference to the most recently frozen versions, so that calling
+     `freeze()` again at one of those versions returns the same frozen Realm even if all other
+     references to it have been released. When this limit is exceeded, the cache releases its
+     reference to the least recently frozen version which is not pinned with `pinFrozenSnapshot()`.
+     The evicted version is still reused while something else references it, and is released once
+     the last reference to it is released. Frozen Realms which are still referenced elsewhere keep
+     their version of the data in the file regardless of this limit.
+
+     Defaults to 0, which means that the cache does not keep frozen Realms alive. Setting a
+     negative value throws an exception.
+     */
+    public static var maximumFrozenVersions: Int {
+        get {
+            return Int(RLMRealm.maximumFrozenVersions)
+        }
+        set {
+            if newValue < 0 {
+                throwRealmException("maximumFrozenVersions must be 0 or greater, not \(newValue)")
+            }
+            RLMRealm.maximumFrozenVersions = UInt(newValue)
+        }
+    }
+
+    /// Statistics about the frozen versions of this Realm's file which are currently cached.
+    public var frozenRealmCacheStatistics: FrozenRealmCacheStatistics {
+        return rlmRealm.frozenRealmCacheStatistics
+    }
+
+    /**
+     Freezes this Realm and keeps the resulting version cached until the returned pin is released.
+
+     Subsequent calls to `freeze()` at the same version return the pinned frozen Realm, and the
+     version is never evicted due to `maximumFrozenVersions`. The pin is released by calling
+     `unpin()` on it or when it is deallocated.
+     */
+    public func pinFrozenSnapshot() -> FrozenRealmPin {
+        return FrozenRealmPin(rlmRealm.pinFrozenSnapshot())
+    }
+
     /**
      Returns a frozen (immutable) snapshot of the given object.
 
@@ -970,6 +1097,36 @@ public typealias AsyncTransactionId = RLMAsyncTransactionId
         return RLMObjectThaw(obj) as? T
     }
 
+    /**
+     Returns frozen (immutable) snapshots of each of the given objects.
+
+     This is equivalent to calling `freeze()` on each object, but is significantly faster for
+     large numbers of objects as the frozen Realm and the information about each object type are
+     looked up once for the whole array. If this Realm is already frozen the objects are returned
+     unchanged.
+
+     - parameter objects: Objects managed by this Realm.
+     - returns: The frozen objects, in the same order.
+     */
+    public func freeze<T: ObjectBase>(_ objects: [T]) -> [T] {
+        return rlmRealm.freezeObjects(objects) as! [T]
+    }
+
+    /**
+     Returns live (mutable) references to each of the given frozen objects.
+
+     This is equivalent to calling `thaw()` on each object, but is significantly faster for large
+     numbers of objects as the live Realm and the information about each object type are looked
+     up once for the whole array. If this Realm is not frozen the objects are returned unchanged.
+
+     - parameter objects: Objects managed by this frozen Realm.
+     - returns: The live objects, in the same order. Objects which have been deleted since the
+                frozen version are `nil`.
+     */
+    public func thaw<T: ObjectBase>(_ objects: [T]) -> [T?] {
+        return rlmRealm.thawObjects(objects).map { $0 as? T }
+    }
+
     /**
      Returns a frozen (immutable) snapshot of the given collection.
 
@@ -18,6 +18,7 @@
 
 import Foundation
 import Realm
+import Realm.Private
 
 /**
  An iterator for a `RealmCollection` instance.
@@ -915,6 +916,33 @@ public extension RealmCollection where Element: ObjectBase {
         })
     }
 
+    /**
+     Sorts this collection by a string property and sections it by the first
+     character of that property, returning the result as an instance of
+     `SectionedResults`. Empty strings are placed in a section with an empty key.
+
+     The section keys are computed directly from the stored values, which is
+     significantly faster than sectioning with a closure for large collections.
+
+     - parameter keyPath: The key path of a persisted string property to sort & section on.
+     - parameter ascending: The direction to sort in.
+
+     - returns: An instance of `SectionedResults`.
+     */
+    func sectioned(byFirstCharacterOf keyPath: KeyPath<Element, String>,
+                   ascending: Bool = true) -> SectionedResults<String, Element> where Element: ObjectBase {
+        let name = _name(for: keyPath)
+        let sortDescriptors = [SortDescriptor(keyPath: name, ascending: ascending)]
+        // Key paths through links and collections which aren't backed by an
+        // RLMCollection fall back to computing the key in Swift
+        if !name.contains("."), let collection = (self as? any RealmCollectionImpl)?.collection {
+            return SectionedResults(rlmSectionedResult: RLMSectionedResultsByFirstCharacter(collection, sortDescriptors.map(ObjectiveCSupport.convert), name))
+        }
+        return sectioned(sortDescriptors: sortDescriptors, {
+            $0[keyPath: keyPath].unicodeScalars.first.map { String($0) } ?? ""
+        })
+    }
+
     /**
      Sorts and sections this collection from a given property key path, returning the result
      as an instance of `SectionedResults`. For every unique value retrieved from the
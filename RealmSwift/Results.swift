@@ -287,4 +287,53 @@ extension Projection: KeypathSortable {}
     }
 }
 
+// MARK: Reading Property Values
+
+extension Results where Element: ObjectBase {
+    /**
+     Returns the values of the given integer property for each object in the results, in the same order as the objects.
+
+     The values are read directly from the Realm into the returned array without creating an object or bridging each
+     value, which is much faster than `value(forKey:)` for reading a single property of many objects.
+
+     - parameter keyPath: The key path of a non-optional `Int` property.
+     */
+    public func values(of keyPath: KeyPath<Element, Int>) -> [Int] {
+        intValues(ofProperty: _name(for: keyPath))
+    }
+
+    /**
+     Returns the values of the given floating-point property for each object in the results, in the same order as the
+     objects.
+
+     The values are read directly from the Realm into the returned array without creating an object or bridging each
+     value.
+
+     - parameter keyPath: The key path of a `Double` property.
+     */
+    public func values(of keyPath: KeyPath<Element, Double>) -> [Double] {
+        doubleValues(ofProperty: _name(for: keyPath))
+    }
+
+    /**
+     Returns the values of the given integer property for each object in the results, in the same order as the objects.
+
+     - parameter property: The name of a non-optional `Int` property.
+     */
+    public func intValues(ofProperty property: String) -> [Int] {
+        unpackInt64Values(ObjectiveCSupport.convert(object: self).int64Values(ofProperty: property))
+    }
+
+    /**
+     Returns the values of the given property for each object in the results as `Double`s, in the same order as the
+     objects. `Int` and `Float` values are converted to `Double`, dates are returned as seconds since 1970, and `nil`
+     values are returned as NaN.
+
+     - parameter property: The name of an `Int`, `Float`, `Double` or `Date` property.
+     */
+    public func doubleValues(ofProperty property: String) -> [Double] {
+        unpackDoubleValues(ObjectiveCSupport.convert(object: self).doubleValues(ofProperty: property))
+    }
+}
+
 extension Results: Encodable where Element: Encodable {}
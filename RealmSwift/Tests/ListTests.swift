@@ -405,6 +405,33 @@ class ListTests: TestCase, @unchecked Sendable {
         assertThrows(array.replaceSubrange(0..<200, with: [str2]))
     }
 
+    func testReorder() {
+        guard let array = array, let str1 = str1, let str2 = str2 else {
+            fatalError("Test precondition failure")
+        }
+
+        array.append(objectsIn: [str1, str2, str2, str1])
+        array.reorder([1, 2, 0, 3])
+        XCTAssertEqual(array.map(\.stringCol), ["2", "2", "1", "1"])
+
+        assertThrows(array.reorder([0, 1]))
+        assertThrows(array.reorder([0, 1, 2, -1]))
+        assertThrows(array.reorder([0, 1, 1, 2]))
+    }
+
+    func testRemoveWhere() {
+        guard let array = array, let str1 = str1, let str2 = str2 else {
+            fatalError("Test precondition failure")
+        }
+
+        array.append(objectsIn: [str1, str2, str1, str2])
+        array.remove { $0.stringCol == "1" }
+        XCTAssertEqual(array.map(\.stringCol), ["2", "2"])
+
+        array.remove(matching: NSPredicate(format: "stringCol = '2'"))
+        XCTAssertEqual(array.count, 0)
+    }
+
     func testSwapAt() {
         guard let array = array, let str1 = str1, let str2 = str2 else {
             fatalError("Test precondition failure")
@@ -344,6 +344,35 @@ class MapTests: TestCase, @unchecked Sendable {
         XCTAssertEqual(expected.count, 0)
     }
 
+    func testEnumerateKeysAndValues() {
+        let map = createMap()
+        for i in 0..<10 {
+            map["key\(i)"] = SwiftStringObject(value: ["key\(i)"])
+        }
+        map.updateValue(nil, forKey: "null")
+
+        var expected = Set((0..<10).map { "key\($0)" })
+        var sawNull = false
+        map.enumerateKeysAndValues { key, value, _ in
+            if let value = value {
+                XCTAssertEqual(key, value.stringCol)
+                expected.remove(key)
+            } else {
+                XCTAssertEqual(key, "null")
+                sawNull = true
+            }
+        }
+        XCTAssertEqual(expected.count, 0)
+        XCTAssertTrue(sawNull)
+
+        var count = 0
+        map.enumerateKeysAndValues { _, _, stop in
+            count += 1
+            stop = count == 3
+        }
+        XCTAssertEqual(count, 3)
+    }
+
     func testValueForKey() {
         let realm = try! Realm()
         try! realm.write {
@@ -341,6 +341,32 @@ class ObjectCreationTests: TestCase, @unchecked Sendable {
         }
     }
 
+    func testCreateMultipleWithValues() {
+        let realm = try! Realm()
+        realm.beginWrite()
+        let objects = realm.create(SwiftStringObject.self, values: [["a"], ["stringCol": "b"]])
+        XCTAssertEqual(objects.map(\.stringCol), ["a", "b"])
+        XCTAssertTrue(objects.allSatisfy { $0.realm == realm })
+        XCTAssertEqual(realm.objects(SwiftStringObject.self).count, 2)
+
+        var progress = [Int]()
+        realm.create(SwiftIntObject.self, values: (0..<25).map { [$0] }, batchSize: 10) { progress.append($0) }
+        XCTAssertEqual(progress, [10, 20, 25])
+        XCTAssertEqual(realm.objects(SwiftIntObject.self).sum(of: \.intCol), 300)
+
+        progress.removeAll()
+        realm.create(SwiftIntObject.self, values: (0..<5).map { [$0] }, batchSize: 0) { progress.append($0) }
+        XCTAssertEqual(progress, [5])
+
+        assertThrows(realm.create(SwiftIntObject.self, values: [[1]], batchSize: -1),
+                     reason: "batchSize must be 0 or greater, not -1")
+        XCTAssertEqual(realm.objects(SwiftIntObject.self).count, 30)
+
+        assertThrows(realm.create(SwiftStringObject.self, values: [["a"]], update: .all),
+                     reason: "'SwiftStringObject' does not have a primary key and can not be updated")
+        realm.cancelWrite()
+    }
+
     func testCreateWithKVCObject() {
         // test with kvc object
         try! Realm().beginWrite()
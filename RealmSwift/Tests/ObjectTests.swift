@@ -2044,6 +2044,31 @@ class ObjectTests: TestCase, @unchecked Sendable {
         XCTAssertNil(thawed, "Thaw should return nil when object was deleted")
     }
 
+    func testFreezeAndThawArray() {
+        let realm = try! Realm()
+        let objects = try! realm.write {
+            (0..<5).map { realm.create(SwiftIntObject.self, value: ["intCol": $0]) }
+        }
+
+        let frozen = realm.freeze(objects)
+        XCTAssertEqual(frozen.count, 5)
+        XCTAssertTrue(frozen.allSatisfy { $0.isFrozen })
+        XCTAssertEqual(frozen.map(\.intCol), [0, 1, 2, 3, 4])
+
+        try! realm.write {
+            objects[0].intCol = 10
+            realm.delete(objects[1])
+        }
+        XCTAssertEqual(frozen[0].intCol, 0)
+
+        let thawed = frozen[0].realm!.thaw(frozen)
+        XCTAssertEqual(thawed.count, 5)
+        XCTAssertEqual(thawed[0]?.intCol, 10)
+        XCTAssertFalse(thawed[0]!.isFrozen)
+        XCTAssertNil(thawed[1])
+        XCTAssertEqual(thawed[4]?.intCol, 4)
+    }
+
     func testThawPreviousVersion() {
         let realm = try! Realm()
         let obj = try! realm.write {
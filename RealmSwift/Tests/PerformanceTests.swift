@@ -158,6 +158,19 @@ class SwiftPerformanceTests: TestCase, @unchecked Sendable {
         }
     }
 
+    func testInsertMultipleLiteralBatched() {
+        let values = Array(repeating: ["a"], count: 100_000)
+        inMeasureBlock {
+            let realm = self.realmWithTestPath()
+            self.startMeasuring()
+            try! realm.write {
+                realm.create(SwiftStringObject.self, values: values, batchSize: values.count)
+            }
+            self.stopMeasuring()
+            self.tearDown()
+        }
+    }
+
     func testCountWhereQuery() {
         let realm = copyRealmToTestPath(largeRealm)
         measure(times: 50) {
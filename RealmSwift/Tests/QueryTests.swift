@@ -9932,6 +9932,40 @@ class QueryTests: TestCase, @unchecked Sendable {
             !$0.optUuid.in([UUIDWrapper(persistedValue: UUID(uuidString: "33041937-05b2-464a-98ad-3910cbe0d09f")!)])
         }
     }
+
+    // MARK: Prepared Queries
+
+    func testPreparedQuery() {
+        let query = PreparedQuery(ModernAllTypesObject.self) { $0.intCol > 0 && $0.stringCol == "" }
+        XCTAssertEqual(query.argumentCount, 2)
+        XCTAssertEqual(query.results(in: realm, 2, "Foó").count, 1)
+        XCTAssertEqual(query.results(in: realm, 3, "Foó").count, 0)
+        XCTAssertEqual(query.filter(objects(), 2, "Foó").count, 1)
+        XCTAssertEqual(query.filter(objects(), 2, "Bar").count, 0)
+
+        let formatQuery = PreparedQuery(ModernAllTypesObject.self, "intCol == %@ OR optStringCol == %@")
+        XCTAssertEqual(formatQuery.argumentCount, 2)
+        XCTAssertEqual(formatQuery.results(in: realm, 3, NSNull()).count, 1)
+        XCTAssertEqual(formatQuery.results(in: realm, 4, "Foó").count, 1)
+        XCTAssertEqual(formatQuery.results(in: realm, 4, Optional<String>.none as Any).count, 0)
+
+        assertThrows(query.results(in: realm, 1), reason: "requires 2 arguments, but 1 were supplied")
+        assertThrows(query.results(in: realm, 1, "a", 2), reason: "requires 2 arguments, but 3 were supplied")
+
+        // Subscript keys are part of the query rather than placeholders, so
+        // they don't shift the arguments which follow them
+        let mapQuery = PreparedQuery(ModernAllTypesObject.self) { $0.mapInt["foo"] == 0 && $0.intCol > 0 }
+        XCTAssertEqual(mapQuery.argumentCount, 2)
+        XCTAssertEqual(mapQuery.results(in: realm, 1, 0).count, 1)
+        XCTAssertEqual(mapQuery.results(in: realm, 2, 0).count, 0)
+
+        let rangeQuery = PreparedQuery(ModernAllTypesObject.self) { $0.intCol.contains(0...0) || $0.stringCol == "" }
+        XCTAssertEqual(rangeQuery.argumentCount, 3)
+        XCTAssertEqual(rangeQuery.results(in: realm, 1, 5, "Bar").count, 1)
+
+        assertThrows(PreparedQuery(ModernAllTypesObject.self, "intCol == %d"),
+                     reason: "prepared queries only support '%@' format specifiers")
+    }
 }
 
 private protocol LinkToTestObject: Object {
@@ -1462,6 +1462,16 @@ class ResultsTests: RealmCollectionTests<Results<CTTNullableStringObjectWithLink
 
         token.invalidate()
     }
+
+    func testPackedPropertyValues() {
+        let collection = getAggregateableCollection().sorted(byKeyPath: "intCol")
+        XCTAssertEqual(collection.values(of: \.intCol), [1, 2, 3])
+        XCTAssertEqual(collection.values(of: \.doubleCol), [1.11, 2.22, 2.22])
+        XCTAssertEqual(collection.intValues(ofProperty: "int8Col"), [1, 2, 3])
+        XCTAssertEqual(collection.doubleValues(ofProperty: "dateCol"), [1, 2, 2])
+        XCTAssertEqual(collection.filter("intCol > 1").values(of: \.intCol), [2, 3])
+        assertThrows(collection.intValues(ofProperty: "doubleCol"), reason: "not supported for double property")
+    }
 }
 
 class ResultsWithCustomInitializerTests: TestCase, @unchecked Sendable {
@@ -1669,6 +1679,15 @@ class ListRealmCollectionTests: RealmCollectionTests<List<CTTNullableStringObjec
         // swiftlint:disable:next line_length
         assertMatches(collection.description, "List<CTTNullableStringObjectWithLink> <0x[0-9a-f]+> \\(\n\t\\[0\\] CTTNullableStringObjectWithLink \\{\n\t\tstringCol = 1;\n\t\tlinkCol = CTTLinkTarget \\{\n\t\t\tid = 1;\n\t\t\\};\n\t\\},\n\t\\[1\\] CTTNullableStringObjectWithLink \\{\n\t\tstringCol = 2;\n\t\tlinkCol = CTTLinkTarget \\{\n\t\t\tid = 1;\n\t\t\\};\n\t\\}\n\\)")
     }
+
+    func testPackedPropertyValues() {
+        let collection = getAggregateableCollection()
+        XCTAssertEqual(collection.values(of: \.intCol), [1, 2, 3])
+        XCTAssertEqual(collection.values(of: \.doubleCol), [1.11, 2.22, 2.22])
+        XCTAssertEqual(collection.intValues(ofProperty: "int8Col"), [1, 2, 3])
+        XCTAssertEqual(collection.doubleValues(ofProperty: "floatCol").map { Float($0) }, [1.1, 2.2, 2.2])
+        assertThrows(collection.intValues(ofProperty: "boolCol"), reason: "not supported for bool property")
+    }
 }
 
 class ListUnmanagedRealmCollectionTests: ListRealmCollectionTests, @unchecked Sendable {
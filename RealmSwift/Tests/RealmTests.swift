@@ -1062,6 +1062,16 @@ class RealmTests: TestCase, @unchecked Sendable {
         XCTAssertFalse(Realm.fileExists(for: config))
     }
 
+    func testMaximumFrozenVersions() {
+        XCTAssertEqual(Realm.maximumFrozenVersions, 0)
+        Realm.maximumFrozenVersions = 3
+        XCTAssertEqual(Realm.maximumFrozenVersions, 3)
+        assertThrows(Realm.maximumFrozenVersions = -1,
+                     reason: "maximumFrozenVersions must be 0 or greater, not -1")
+        XCTAssertEqual(Realm.maximumFrozenVersions, 3)
+        Realm.maximumFrozenVersions = 0
+    }
+
     func testThaw() {
         XCTAssertEqual(try! Realm().objects(SwiftBoolObject.self).count, 0)
         let realm = try! Realm()
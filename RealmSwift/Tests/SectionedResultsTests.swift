@@ -348,6 +348,26 @@ class SectionedResultsTests: SectionedResultsTestsBase {
         assert(ascending: false, sectionCount: 3, sectionKeys: ["c", "b", "a"])
     }
 
+    func testSectionedByFirstCharacter() {
+        let realm = createObjects()
+        let results = realm.objects(ModernAllTypesObject.self)
+
+        var sectionedResults = results.sectioned(byFirstCharacterOf: \.stringCol)
+        XCTAssertEqual(sectionedResults.allKeys, ["a", "b", "c"])
+        XCTAssertEqual(sectionedResults[1].count, 2)
+        sectionedResults = results.sectioned(byFirstCharacterOf: \.stringCol, ascending: false)
+        XCTAssertEqual(sectionedResults.allKeys, ["c", "b", "a"])
+
+        try! realm.write {
+            realm.create(ModernAllTypesObject.self, value: ["stringCol": "\u{e9}clair"])
+            realm.create(ModernAllTypesObject.self, value: ["stringCol": ""])
+        }
+        XCTAssertEqual(Set(sectionedResults.allKeys), ["", "a", "b", "c", "\u{e9}"])
+
+        let anyCollection = AnyRealmCollection(results)
+        XCTAssertEqual(Set(anyCollection.sectioned(byFirstCharacterOf: \.stringCol).allKeys), ["", "a", "b", "c", "\u{e9}"])
+    }
+
     func testAllKeys() {
         let realm = createObjects()
         let results = realm.objects(ModernAllTypesObject.self)
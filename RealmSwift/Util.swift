@@ -50,6 +50,22 @@ internal func notFoundToNil(index: UInt) -> Int? {
     return Int(index)
 }
 
+// Unpacks the buffers returned by `int64ValuesOfProperty:` and
+// `doubleValuesOfProperty:` without bridging each element. The bytes are
+// copied out rather than bound in place as `Data` doesn't guarantee that its
+// storage is suitably aligned.
+internal func unpackInt64Values(_ data: Data) -> [Int] {
+    var values = [Int64](repeating: 0, count: data.count / MemoryLayout<Int64>.size)
+    _ = values.withUnsafeMutableBytes { data.copyBytes(to: $0) }
+    return values.map { Int($0) }
+}
+
+internal func unpackDoubleValues(_ data: Data) -> [Double] {
+    var values = [Double](repeating: 0, count: data.count / MemoryLayout<Double>.size)
+    _ = values.withUnsafeMutableBytes { data.copyBytes(to: $0) }
+    return values
+}
+
 internal func throwRealmException(_ message: String, userInfo: [AnyHashable: Any]? = nil) -> Never {
     NSException(name: NSExceptionName(rawValue: RLMExceptionName), reason: message, userInfo: userInfo).raise()
     fatalError() // unreachable